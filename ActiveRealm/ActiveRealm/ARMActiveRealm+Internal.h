@@ -28,8 +28,19 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class RLMObject;
+
 @interface ARMActiveRealm (Internal)
 
+/**
+ * Creates a model filled with the values of specified stored object.
+ * Unlike `-init`, it does not generate the primary key and the timestamps that are overwritten by the stored values.
+ *
+ * @param obj A stored object.
+ * @return A model.
+ */
++ (instancetype)activeRealmWithRLMObject:(RLMObject *)obj;
+
 - (id)objectForKeyedSubscript:(NSString *)prop;
 - (void)setObject:(id)obj forKeyedSubscript:(NSString *)prop;
 
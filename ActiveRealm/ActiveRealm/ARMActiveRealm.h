@@ -42,6 +42,21 @@ typedef NS_OPTIONS(NSInteger, ARMSavingOption) {
      * The `updatedAt` property is not automatically updated.
      */
     ARMSavingOptionNotAutomaticallyUpdateTimestamp,
+    /**
+     * The callbacks such as `beforeSave:` and `afterSave:` are not called.
+     */
+    ARMSavingOptionWithoutCallbacks = 1 << 1,
+};
+
+typedef NS_OPTIONS(NSInteger, ARMInsertingOption) {
+    /**
+     * No option. The rows are written directly without initializing models.
+     */
+    ARMInsertingOptionNone,
+    /**
+     * Models are initialized from the rows, validated and passed to the callbacks such as `beforeSave:`.
+     */
+    ARMInsertingOptionWithCallbacks = 1 << 0,
 };
 
 @interface ARMActiveRealm : NSObject
@@ -74,12 +89,14 @@ typedef NS_OPTIONS(NSInteger, ARMSavingOption) {
 
 /**
  * The `save` means INSERT if the record does not exists in the DB, otherwise UPDATE it.
+ * UPDATE writes only the properties changed from the DB, and commits nothing if no property has been changed.
  *
  * @return YES if the validation is successful, otherwise NO.
  */
 - (BOOL)save;
 /**
  * The `save` means INSERT if the record does not exists in the DB, otherwise UPDATE it.
+ * UPDATE writes only the properties changed from the DB, and commits nothing if no property has been changed.
  *
  * @param options Options.
  * @return YES if the validation is successful, otherwise NO.
@@ -113,6 +130,14 @@ typedef NS_OPTIONS(NSInteger, ARMSavingOption) {
  * @return Relationships definition.
  */
 + (NSDictionary<NSString *, ARMRelationship *> *)definedRelationships;
+/**
+ * ActiveRealm indexes the foreign keys of the relationships of type `ARMInverseRelationshipTypeBelongsTo` in the DB.
+ * If you want to index other properties you often query, override this method.
+ * The indexes are applied to the mapped ARMObject subclass when Realm builds its schema.
+ *
+ * @return Indexed property names in addition to the foreign keys.
+ */
++ (NSArray<NSString *> *)indexedProperties;
 /**
  * ActiveRealm can validate data before saving a model. By default, the validation is always successful.
  * If you want to validate data, override this method. When the method returns false, the data isn't saved.
@@ -188,9 +213,24 @@ typedef NS_OPTIONS(NSInteger, ARMSavingOption) {
  * Find an object by specified ID.
  *
  * @param uid The primary key generated by ActiveRealm automatically.
- * @return An object.
+ * @return An object. nil if `uid` is nil.
+ */
++ (nullable instancetype)findByID:(nullable NSString *)uid NS_SWIFT_NAME(find(ID:));
+/**
+ * Find objects by specified IDs. Each object is built once even if its ID is repeated.
+ *
+ * @param uids The primary keys generated by ActiveRealm automatically.
+ * @return Objects in the same order as `uids`. The IDs that are not found are skipped.
  */
-+ (nullable instancetype)findByID:(NSString *)uid NS_SWIFT_NAME(find(ID:));
++ (NSArray<__kindof ARMActiveRealm *> *)findByIDs:(NSArray<NSString *> *)uids NS_SWIFT_NAME(find(IDs:));
+/**
+ * Find objects by specified IDs.
+ *
+ * @param uids The primary keys generated by ActiveRealm automatically.
+ * @return Objects keyed by ID. The IDs that are not found are not contained.
+ */
++ (NSDictionary<NSString *, __kindof ARMActiveRealm *> *)findDictionaryByIDs:(NSArray<NSString *> *)uids
+    NS_SWIFT_NAME(findDictionary(IDs:));
 /**
  * Find an object by specified parameters. When multiple objects are found, select first object.
  *
@@ -248,6 +288,55 @@ typedef NS_OPTIONS(NSInteger, ARMSavingOption) {
  * @return An object.
  */
 + (instancetype)findOrCreate:(NSDictionary<NSString *, id> *)dictionary;
+/**
+ * Saves multiple objects in a single write transaction. Each object is validated and the callbacks are called
+ * same as `save`. Objects that fail the validation are not saved, but the others are saved.
+ *
+ * @param objects Objects.
+ * @param options Options.
+ * @return Objects that failed the validation.
+ */
++ (NSArray<__kindof ARMActiveRealm *> *)saveAll:(NSArray<__kindof ARMActiveRealm *> *)objects
+                                        options:(ARMSavingOption)options NS_SWIFT_NAME(saveAll(_:options:));
+/**
+ * Saves multiple objects committing a write transaction every specified number of objects.
+ * Each object is validated and the callbacks are called same as `save`. Objects that fail the validation are not
+ * saved, but the others are saved.
+ *
+ * @param objects Objects.
+ * @param options Options.
+ * @param chunkSize The number of objects saved in a write transaction. 0 means all objects in one transaction.
+ * @return Objects that failed the validation.
+ */
++ (NSArray<__kindof ARMActiveRealm *> *)saveAll:(NSArray<__kindof ARMActiveRealm *> *)objects
+                                        options:(ARMSavingOption)options
+                                      chunkSize:(NSUInteger)chunkSize NS_SWIFT_NAME(saveAll(_:options:chunkSize:));
+/**
+ * Inserts objects initialized with specified rows. Same as `insertAll:options:chunkSize:` with no option.
+ *
+ * @param rows Parameters of objects.
+ * @return The primary keys of inserted objects.
+ */
++ (NSArray<NSString *> *)insertAll:(NSArray<NSDictionary<NSString *, id> *> *)rows;
+/**
+ * Inserts objects initialized with specified rows, committing a write transaction every specified number of rows.
+ * The `uid`, `createdAt` and `updatedAt` are generated if a row does not have them or they are NSNull. All rows get
+ * the same generated timestamps, the time of the call, so collections order them by `uid`. The primary keys of rows
+ * must be distinct and must not exist in the DB, otherwise NSInvalidArgumentException is raised before any row is
+ * inserted.
+ *
+ * By default, the rows are written directly without initializing models, so they are neither validated nor passed to
+ * the callbacks. If ARMInsertingOptionWithCallbacks is specified, models are initialized and saved as `saveAll:`, and
+ * the rows that fail the validation are not inserted.
+ *
+ * @param rows Parameters of objects.
+ * @param options Options.
+ * @param chunkSize The number of rows inserted in a write transaction. 0 means all rows in one transaction.
+ * @return The primary keys of inserted objects.
+ */
++ (NSArray<NSString *> *)insertAll:(NSArray<NSDictionary<NSString *, id> *> *)rows
+                           options:(ARMInsertingOption)options
+                         chunkSize:(NSUInteger)chunkSize NS_SWIFT_NAME(insertAll(_:options:chunkSize:));
 /**
  * Find multiple objects by specified parameters.
  *
@@ -685,6 +774,55 @@ NS_SWIFT_NAME(asJSONString(included:addingPropertiesWith:methods:));
  * @return The number of objects.
  */
 + (NSUInteger)countWithPredicate:(NSPredicate *)predicate NS_SWIFT_NAME(count(predicate:)) DEPRECATED_ATTRIBUTE;
+/**
+ * Returns whether an object searched by specified parameters exists. No models are built.
+ *
+ * @param dictionary Parameters for searching.
+ * @return YES if an object exists.
+ */
++ (BOOL)exists:(NSDictionary<NSString *, id> *)dictionary NS_SWIFT_NAME(exists(_:));
+/**
+ * Returns whether an object searched by specified searching condition exists. No models are built.
+ *
+ * @param predicate A NSPredicate.
+ * @return YES if an object exists.
+ */
++ (BOOL)existsWithPredicate:(NSPredicate *)predicate NS_SWIFT_NAME(exists(predicate:));
+/**
+ * Returns whether an object of specified primary key exists. No models are built.
+ *
+ * @param uid A primary key.
+ * @return YES if the object exists. NO if `uid` is nil.
+ */
++ (BOOL)existsWithID:(nullable NSString *)uid NS_SWIFT_NAME(exists(ID:));
+/**
+ * Returns the sum of specified property of all objects of the model.
+ *
+ * @param property A property of int, float, double or decimal type.
+ * @return The sum. 0 if there are no objects.
+ */
++ (NSNumber *)sum:(NSString *)property;
+/**
+ * Returns the average of specified property of all objects of the model.
+ *
+ * @param property A property of int, float, double or decimal type.
+ * @return The average, or nil if there are no objects.
+ */
++ (nullable NSNumber *)average:(NSString *)property;
+/**
+ * Returns the minimum value of specified property of all objects of the model.
+ *
+ * @param property A property of int, float, double, decimal or date type.
+ * @return The minimum value, or nil if there are no objects.
+ */
++ (nullable id)min:(NSString *)property;
+/**
+ * Returns the maximum value of specified property of all objects of the model.
+ *
+ * @param property A property of int, float, double, decimal or date type.
+ * @return The maximum value, or nil if there are no objects.
+ */
++ (nullable id)max:(NSString *)property;
 
 @end
 
@@ -24,6 +24,7 @@
 // SOFTWARE.
 //
 
+#import <objc/runtime.h>
 #import <Realm/Realm.h>
 #import <ActiveRealm/ActiveRealm.h>
 
@@ -32,8 +33,8 @@
 
 #import "ARMActiveRealmManager.h"
 #import "ARMCollection.h"
+#import "ARMModelSchema.h"
 #import "ARMObject.h"
-#import "ARMProperty.h"
 #import "ARMQuery.h"
 #import "ARMRelation.h"
 #import "ARMRelation+Internal.h"
@@ -44,7 +45,8 @@
 @property (nonatomic, copy) NSString *uid;
 @property (nonatomic) NSDate *createdAt;
 @property (nonatomic) NSDate *updatedAt;
-@property (nonatomic, copy) NSDictionary<NSString *, ARMRelation *> *relations;
+
+- (instancetype)initForHydration;
 
 @end
 
@@ -54,26 +56,22 @@
 
 @end
 
-@implementation ARMActiveRealm
+@implementation ARMActiveRealm {
+    // YES if the model was loaded from or saved to the DB. An ivar, not a property, so that the runtime property list
+    // the schema is built from does not include it.
+    BOOL _persisted;
+    // YES while `-initForHydration` initializes this model. Set on the instance, so that models created by initializers
+    // of subclasses are initialized normally.
+    BOOL _hydrating;
+}
 
 static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 
-+ (NSArray<NSString *> *)propertyNames {
-    NSMutableArray *properties = [NSMutableArray new];
-
-    for (NSString *prop in self.properties.allKeys) {
-        if (![self.ignoredProperties containsObject:prop] &&
-            !self.definedRelationships[prop] &&
-            ![prop isEqualToString:@"relations"] &&
-            ![prop isEqualToString:@"description"] &&
-            ![prop isEqualToString:@"debugDescription"] &&
-            ![prop isEqualToString:@"hash"]) {
-
-            [properties addObject:prop];
-        }
-    }
+// Up to this number of IDs, `+findByIDs:` probes the primary key for each ID instead of a query.
+static const NSUInteger kActiveRealmMaxPrimaryKeyProbes = 32;
 
-    return properties;
++ (NSArray<NSString *> *)propertyNames {
+    return [ARMModelSchema schemaForClass:self].propertyNames;
 }
 
 + (ARMQuery *)query {
@@ -88,26 +86,45 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
     return @{};
 }
 
++ (NSArray<NSString *> *)indexedProperties {
+    return @[];
+}
+
 + (BOOL)validateBeforeSaving:(id)obj {
     return YES;
 }
 
 - (instancetype)init {
     if (self = [super init]) {
+        // A hydrated object gets the primary key and the timestamps from `+activeRealmWithRLMObject:`.
+        if (_hydrating) {
+            _hydrating = NO;
+
+            return self;
+        }
+
         _uid = [NSUUID UUID].UUIDString.uppercaseString;
         _createdAt = [NSDate date];
         _updatedAt = _createdAt;
+    }
 
-        NSMutableDictionary<NSString *, ARMRelation *> *relations = [NSMutableDictionary new];
+    return self;
+}
 
-        for (NSString *prop in self.class.definedRelationships) {
-            relations[prop] = [ARMRelation relationWithObject:self relationship:self.class.definedRelationships[prop]];
-        }
+/**
+ * Initializes a model through `-init` of the class without generating the primary key and the timestamps.
+ */
+- (instancetype)initForHydration {
+    _hydrating = YES;
 
-        _relations = relations;
-    }
+    return [self init];
+}
 
-    return self;
+#pragma mark - property
+
+- (NSDictionary<NSString *, ARMRelation *> *)relations {
+    // Not cached on the model because the dictionary holds the model. A relation is created only for the accessed key.
+    return [[ARMRelationDictionary alloc] initWithObject:self schema:[ARMModelSchema schemaForClass:self.class]];
 }
 
 #pragma mark - public method
@@ -121,13 +138,21 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
         return NO;
     }
 
-    if ([self.class findByID:self[kActiveRealmPrimaryKeyName]]) {
-        [self updateWithOptions:options];
-    }
-    else {
-        [self create];
+    RLMObject *obj = [self storedRealmObject];
+    BOOL creating = !obj;
+
+    NSIndexSet *slots = [self willSaveWithOptions:options storedObject:obj];
+
+    // Nothing is committed if no property has been changed since the model was loaded or saved.
+    if (!slots || slots.count > 0) {
+        RLMRealm *realm = ARMActiveRealmManager.sharedInstance.defaultRealm;
+        [realm transactionWithBlock:^{
+            [self writeToRealm:realm storedObject:obj slots:slots];
+        }];
     }
 
+    [self didSaveWithOptions:options creating:creating];
+
     return YES;
 }
 
@@ -136,19 +161,24 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 }
 
 - (void)destroyWithCascade:(BOOL)cascade {
-    RLMObject *obj = [self.class object:self.class forPrimaryKey:self[kActiveRealmPrimaryKeyName]];
+    RLMObject *obj = [self.class object:self.class forPrimaryKey:self.uid];
 
     if (!obj) {
         return;
     }
 
     if (cascade) {
-        for (NSString *prop in self.relations) {
-            if (self.relations[prop].hasOne) {
-                [self.relations[prop].object destroy];
+        NSDictionary<NSString *, ARMRelation *> *relations = self.relations;
+
+        for (NSString *prop in relations) {
+            ARMRelation *relation = relations[prop];
+
+            // Each relation is fetched once. A relation without objects has nothing to walk.
+            if (relation.hasOne) {
+                [relation.object destroy];
             }
-            else if (self.relations[prop].hasMany) {
-                for (ARMActiveRealm *activeRealm in self.relations[prop].objects) {
+            else if (relation.hasMany) {
+                for (ARMActiveRealm *activeRealm in relation.objects) {
                     [activeRealm destroy];
                 }
             }
@@ -162,11 +192,13 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
         [realm deleteObject:obj];
     }];
 
+    _persisted = NO;
+
     [self.class afterDestroy:self];
 }
 
 + (NSArray<__kindof ARMActiveRealm *> *)all {
-    return [self.query.all order:@"createdAt" ascending:YES].toArray;
+    return self.query.all.toArray;
 }
 
 + (NSArray<__kindof ARMActiveRealm *> *)allOrderedBy:(NSString *)order ascending:(BOOL)ascending {
@@ -203,8 +235,57 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
     return [[self.query.all order:order ascending:ascending] lastWithLimit:limit];
 }
 
-+ (nullable instancetype)findByID:(NSString *)uid {
-    return [self.query whereWithPredicate:[NSPredicate predicateWithFormat:@"uid=%@", uid]].first;
++ (nullable instancetype)findByID:(nullable NSString *)uid {
+    // Realm raises for a nil primary key. The foreign key of an unsaved belongsTo relation may be nil.
+    if (!uid) {
+        return nil;
+    }
+
+    RLMObject *obj = [self object:self forPrimaryKey:uid];
+
+    return obj ? [self activeRealmWithRLMObject:obj] : nil;
+}
+
++ (NSArray<__kindof ARMActiveRealm *> *)findByIDs:(NSArray<NSString *> *)uids {
+    NSDictionary<NSString *, ARMActiveRealm *> *activeRealms = [self findDictionaryByIDs:uids];
+    NSMutableArray<ARMActiveRealm *> *array = [NSMutableArray arrayWithCapacity:uids.count];
+
+    for (NSString *uid in uids) {
+        if (activeRealms[uid]) {
+            [array addObject:activeRealms[uid]];
+        }
+    }
+
+    return array;
+}
+
++ (NSDictionary<NSString *, __kindof ARMActiveRealm *> *)findDictionaryByIDs:(NSArray<NSString *> *)uids {
+    NSMutableDictionary<NSString *, ARMActiveRealm *> *activeRealms = [NSMutableDictionary new];
+
+    // A probe is cheaper for a few IDs, and a single query is cheaper for many IDs.
+    if (uids.count <= kActiveRealmMaxPrimaryKeyProbes) {
+        for (NSString *uid in uids) {
+            RLMObject *obj = activeRealms[uid] ? nil : [self object:self forPrimaryKey:uid];
+
+            if (obj) {
+                activeRealms[uid] = [self activeRealmWithRLMObject:obj];
+            }
+        }
+
+        return activeRealms;
+    }
+
+    Class rlmObjClass = [ARMModelSchema schemaForClass:self].realmClass;
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K IN %@", kActiveRealmPrimaryKeyName, uids];
+    RLMResults *results = [rlmObjClass objectsInRealm:ARMActiveRealmManager.sharedInstance.defaultRealm
+                                        withPredicate:predicate];
+
+    for (RLMObject *obj in results) {
+        ARMActiveRealm *activeRealm = [self activeRealmWithRLMObject:obj];
+        activeRealms[activeRealm.uid] = activeRealm;
+    }
+
+    return activeRealms;
 }
 
 + (nullable instancetype)find:(NSDictionary<NSString *, id> *)dictionary {
@@ -248,13 +329,16 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 
     activeRealm = [self.class new];
 
-    for (NSString *prop in self.class.propertyNames) {
-        if (!self.definedRelationships[prop] &&
-            ![prop isEqualToString:@"uid"] &&
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self];
+
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        NSString *prop = schema.propertyNames[i];
+
+        if (![prop isEqualToString:@"uid"] &&
             ![prop isEqualToString:@"createdAt"] &&
             ![prop isEqualToString:@"updatedAt"]) {
 
-            activeRealm[prop] = dictionary[prop];
+            ARMPropertyAccessorSetValue(&schema.accessors[i], activeRealm, dictionary[prop]);
         }
     }
 
@@ -270,13 +354,16 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 
     activeRealm = [self.class new];
 
-    for (NSString *prop in self.class.propertyNames) {
-        if (!self.definedRelationships[prop] &&
-            ![prop isEqualToString:@"uid"] &&
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self];
+
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        NSString *prop = schema.propertyNames[i];
+
+        if (![prop isEqualToString:@"uid"] &&
             ![prop isEqualToString:@"createdAt"] &&
             ![prop isEqualToString:@"updatedAt"]) {
 
-            activeRealm[prop] = dictionary[prop];
+            ARMPropertyAccessorSetValue(&schema.accessors[i], activeRealm, dictionary[prop]);
         }
     }
 
@@ -285,6 +372,115 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
     return activeRealm;
 }
 
++ (NSArray<__kindof ARMActiveRealm *> *)saveAll:(NSArray<__kindof ARMActiveRealm *> *)objects
+                                        options:(ARMSavingOption)options {
+
+    return [self saveAll:objects options:options chunkSize:0];
+}
+
++ (NSArray<__kindof ARMActiveRealm *> *)saveAll:(NSArray<__kindof ARMActiveRealm *> *)objects
+                                        options:(ARMSavingOption)options
+                                      chunkSize:(NSUInteger)chunkSize {
+
+    NSMutableArray<ARMActiveRealm *> *invalidObjects = [NSMutableArray new];
+    NSUInteger size = chunkSize > 0 ? chunkSize : MAX(objects.count, 1);
+    RLMRealm *realm = ARMActiveRealmManager.sharedInstance.defaultRealm;
+
+    for (NSUInteger location = 0; location < objects.count; location += size) {
+        @autoreleasepool {
+            NSRange range = NSMakeRange(location, MIN(size, objects.count - location));
+            NSMutableArray<ARMActiveRealm *> *models = [NSMutableArray new];
+            NSMutableArray *storedObjects = [NSMutableArray new];
+            NSMutableArray *changedSlots = [NSMutableArray new];
+            BOOL changed = NO;
+
+            for (ARMActiveRealm *model in [objects subarrayWithRange:range]) {
+                if (![model.class validateBeforeSaving:model]) {
+                    [invalidObjects addObject:model];
+                    continue;
+                }
+
+                RLMObject *obj = [model storedRealmObject];
+                NSIndexSet *slots = [model willSaveWithOptions:options storedObject:obj];
+                changed = changed || !slots || slots.count > 0;
+
+                [models addObject:model];
+                [storedObjects addObject:(id) obj ?: [NSNull null]];
+                [changedSlots addObject:(id) slots ?: [NSNull null]];
+            }
+
+            if (changed) {
+                [realm transactionWithBlock:^{
+                    for (NSUInteger i = 0; i < models.count; i++) {
+                        RLMObject *obj = storedObjects[i] != [NSNull null] ? storedObjects[i] : nil;
+                        NSIndexSet *slots = changedSlots[i] != [NSNull null] ? changedSlots[i] : nil;
+
+                        if (!slots || slots.count > 0) {
+                            [models[i] writeToRealm:realm storedObject:obj slots:slots];
+                        }
+                    }
+                }];
+            }
+
+            for (NSUInteger i = 0; i < models.count; i++) {
+                [models[i] didSaveWithOptions:options creating:storedObjects[i] == [NSNull null]];
+            }
+        }
+    }
+
+    return invalidObjects;
+}
+
++ (NSArray<NSString *> *)insertAll:(NSArray<NSDictionary<NSString *, id> *> *)rows {
+    return [self insertAll:rows options:ARMInsertingOptionNone chunkSize:0];
+}
+
++ (NSArray<NSString *> *)insertAll:(NSArray<NSDictionary<NSString *, id> *> *)rows
+                           options:(ARMInsertingOption)options
+                         chunkSize:(NSUInteger)chunkSize {
+
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self];
+    [self validateNewPrimaryKeysOfRows:rows];
+    // All rows of a call share the generated timestamps. Their primary keys break the ties in collections.
+    NSDate *now = [NSDate date];
+
+    if (options & ARMInsertingOptionWithCallbacks) {
+        NSMutableArray<ARMActiveRealm *> *models = [NSMutableArray new];
+
+        for (NSDictionary<NSString *, id> *row in rows) {
+            NSDictionary<NSString *, id> *values = [self insertionValuesFromRow:row schema:schema date:now];
+            [models addObject:[self activeRealmWithDictionary:values schema:schema]];
+        }
+
+        NSArray *invalidObjects = [self saveAll:models options:ARMSavingOptionNone chunkSize:chunkSize];
+        [models removeObjectsInArray:invalidObjects];
+
+        return [models valueForKey:kActiveRealmPrimaryKeyName];
+    }
+
+    NSMutableArray<NSString *> *uids = [NSMutableArray new];
+    NSUInteger size = chunkSize > 0 ? chunkSize : MAX(rows.count, 1);
+    RLMRealm *realm = ARMActiveRealmManager.sharedInstance.defaultRealm;
+
+    for (NSUInteger location = 0; location < rows.count; location += size) {
+        NSRange range = NSMakeRange(location, MIN(size, rows.count - location));
+
+        [realm transactionWithBlock:^{
+            for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+                @autoreleasepool {
+                    NSDictionary<NSString *, id> *values = [self insertionValuesFromRow:rows[i]
+                                                                                 schema:schema
+                                                                                   date:now];
+                    [schema.realmClass createInRealm:realm withValue:values];
+                    [uids addObject:values[kActiveRealmPrimaryKeyName]];
+                }
+            }
+        }];
+    }
+
+    return uids;
+}
+
 + (NSArray<__kindof ARMActiveRealm *> *)where:(NSDictionary<NSString *, id> *)dictionary {
     return [self.query where:dictionary].toArray;
 }
@@ -417,69 +613,214 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 
 #pragma mark - private method
 
-+ (NSDictionary<NSString *, NSString *> *)properties {
-    NSMutableDictionary *props = self.superclass != NSObject.class ?
-        ARMGetProperties(self.superclass).mutableCopy : [NSMutableDictionary new];
-    NSDictionary *selfProps = ARMGetProperties(self.class);
+/**
+ * Initializes a model with the properties in a row. The generated `uid` and timestamps are kept unless the row has
+ * them.
+ */
++ (instancetype)activeRealmWithDictionary:(NSDictionary<NSString *, id> *)dictionary schema:(ARMModelSchema *)schema {
+    ARMActiveRealm *activeRealm = [self new];
 
-    // Merge properties of superclass and self class.
-    for (NSString *key in selfProps) {
-        props[key] = selfProps[key];
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        id value = dictionary[schema.propertyNames[i]];
+
+        if (value) {
+            ARMPropertyAccessorSetValue(&schema.accessors[i], activeRealm, value == [NSNull null] ? nil : value);
+        }
     }
 
-    return props;
+    return activeRealm;
 }
 
-- (void)create {
-    [self.class beforeCreate:self];
-    [self.class beforeSave:self];
+/**
+ * Returns the values of the persisted properties of a row to insert. The primary key and the timestamps are generated
+ * if the row does not have them or they are NSNull.
+ *
+ * @param row Parameters of an object.
+ * @param schema The schema of the model.
+ * @param date The creation date of generated timestamps.
+ * @return The values keyed by property name.
+ */
++ (NSDictionary<NSString *, id> *)insertionValuesFromRow:(NSDictionary<NSString *, id> *)row
+                                                  schema:(ARMModelSchema *)schema
+                                                    date:(NSDate *)date {
+
+    NSMutableDictionary<NSString *, id> *values = [NSMutableDictionary new];
 
-    Class realmClass = [[ARMActiveRealmManager sharedInstance] map:self.class];
-    id obj = [realmClass new];
+    for (NSString *prop in schema.propertyNames) {
+        values[prop] = row[prop];
+    }
 
-    for (NSString *prop in self.class.propertyNames) {
-        if (!self.class.definedRelationships[prop]) {
-            obj[prop] = self[prop];
+    for (NSString *prop in @[ kActiveRealmPrimaryKeyName, @"createdAt", @"updatedAt" ]) {
+        if (values[prop] == [NSNull null]) {
+            [values removeObjectForKey:prop];
         }
     }
 
-    RLMRealm *realm = ARMActiveRealmManager.sharedInstance.defaultRealm;
-    [realm transactionWithBlock:^{
-        [realm addObject:obj];
-    }];
+    if (!values[kActiveRealmPrimaryKeyName]) {
+        values[kActiveRealmPrimaryKeyName] = [NSUUID UUID].UUIDString.uppercaseString;
+    }
 
-    [self.class afterCreate:self];
-    [self.class afterSave:self];
+    if (!values[@"createdAt"]) {
+        values[@"createdAt"] = date;
+    }
+
+    if (!values[@"updatedAt"]) {
+        values[@"updatedAt"] = values[@"createdAt"];
+    }
+
+    return values;
 }
 
-- (void)updateWithOptions:(ARMSavingOption)options {
-    [self.class beforeUpdate:self];
-    [self.class beforeSave:self];
+/**
+ * Raises NSInvalidArgumentException if a primary key of the rows is repeated or exists in the DB. It is checked before
+ * writing, so that no row is inserted and the rows are not overwritten.
+ *
+ * @param rows Parameters of objects.
+ */
++ (void)validateNewPrimaryKeysOfRows:(NSArray<NSDictionary<NSString *, id> *> *)rows {
+    NSMutableArray *uids = [NSMutableArray new];
 
-    RLMObject *obj = [self.class object:self.class forPrimaryKey:self[kActiveRealmPrimaryKeyName]];
+    for (NSDictionary<NSString *, id> *row in rows) {
+        id uid = row[kActiveRealmPrimaryKeyName];
 
-    if (!obj) {
+        if (uid && uid != [NSNull null]) {
+            [uids addObject:uid];
+        }
+    }
+
+    if (uids.count == 0) {
         return;
     }
 
-    if (!(options & ARMSavingOptionNotAutomaticallyUpdateTimestamp)) {
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K IN %@", kActiveRealmPrimaryKeyName, uids];
+
+    if ([NSSet setWithArray:uids].count != uids.count || [self existsWithPredicate:predicate]) {
+        [NSException raise:NSInvalidArgumentException format:@"The primary keys of the rows must be new."];
+    }
+}
+
+- (nullable RLMObject *)storedRealmObject {
+    // The primary key of a model that has never been stored is newly generated, so it can not be in the DB.
+    return _persisted ? [self.class object:self.class forPrimaryKey:self.uid] : nil;
+}
+
+/**
+ * Calls the before callbacks and updates the timestamp.
+ *
+ * @param options Options.
+ * @param obj The stored object of the model if exists.
+ * @return The slots of the properties changed from the stored object, or nil if the whole model must be written.
+ */
+- (nullable NSIndexSet *)willSaveWithOptions:(ARMSavingOption)options storedObject:(nullable RLMObject *)obj {
+    BOOL creating = !obj;
+
+    if (!(options & ARMSavingOptionWithoutCallbacks)) {
+        if (creating) {
+            [self.class beforeCreate:self];
+        }
+        else {
+            [self.class beforeUpdate:self];
+        }
+
+        [self.class beforeSave:self];
+    }
+
+    if (creating || obj.isInvalidated) {
+        return nil;
+    }
+
+    NSMutableIndexSet *slots = [self changedSlotsFromStoredObject:obj];
+
+    if (slots.count > 0 && !(options & ARMSavingOptionNotAutomaticallyUpdateTimestamp)) {
         self.updatedAt = [NSDate date];
+        [slots addIndex:[[ARMModelSchema schemaForClass:self.class] slotForProperty:@"updatedAt"]];
     }
 
-    [ARMActiveRealmManager.sharedInstance.defaultRealm transactionWithBlock:^{
-        for (NSString *prop in self.class.propertyNames) {
-            if (![prop isEqualToString:kActiveRealmPrimaryKeyName] && !self.class.definedRelationships[prop]) {
-                obj[prop] = self[prop];
-            }
+    return slots;
+}
+
+/**
+ * Compares the persisted properties with the stored object.
+ *
+ * @param obj The stored object of the model.
+ * @return The slots of the properties whose values differ from the stored object.
+ */
+- (NSMutableIndexSet *)changedSlotsFromStoredObject:(RLMObject *)obj {
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
+    NSMutableIndexSet *slots = [NSMutableIndexSet new];
+
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        NSString *prop = schema.propertyNames[i];
+
+        if ([prop isEqualToString:kActiveRealmPrimaryKeyName]) {
+            continue;
+        }
+
+        id value = ARMPropertyAccessorGetValue(&schema.accessors[i], self);
+        id storedValue = obj[prop];
+        value = value != [NSNull null] ? value : nil;
+        storedValue = storedValue != [NSNull null] ? storedValue : nil;
+
+        if (value != storedValue && ![value isEqual:storedValue]) {
+            [slots addIndex:i];
         }
+    }
+
+    return slots;
+}
+
+/**
+ * Writes the model to the DB. Call in a write transaction.
+ *
+ * @param realm The Realm in a write transaction.
+ * @param obj The stored object of the model if exists.
+ * @param slots The slots of the properties to write, or nil to write the whole model.
+ */
+- (void)writeToRealm:(RLMRealm *)realm storedObject:(nullable RLMObject *)obj slots:(nullable NSIndexSet *)slots {
+    // The stored object may have been deleted since it was found. Add or update in case the same primary key was
+    // stored by another model.
+    if (!obj || obj.isInvalidated || !slots) {
+        [realm addOrUpdateObject:[self makeRealmObject]];
+        return;
+    }
+
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
+
+    [slots enumerateIndexesUsingBlock:^(NSUInteger i, BOOL *stop) {
+        obj[schema.propertyNames[i]] = ARMPropertyAccessorGetValue(&schema.accessors[i], self);
     }];
+}
+
+- (void)didSaveWithOptions:(ARMSavingOption)options creating:(BOOL)creating {
+    _persisted = YES;
+
+    if (options & ARMSavingOptionWithoutCallbacks) {
+        return;
+    }
+
+    if (creating) {
+        [self.class afterCreate:self];
+    }
+    else {
+        [self.class afterUpdate:self];
+    }
 
-    [self.class afterUpdate:self];
     [self.class afterSave:self];
 }
 
+- (RLMObject *)makeRealmObject {
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
+    RLMObject *obj = [schema.realmClass new];
+
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        obj[schema.propertyNames[i]] = ARMPropertyAccessorGetValue(&schema.accessors[i], self);
+    }
+
+    return obj;
+}
+
 + (nullable RLMObject *)object:(Class)aClass forPrimaryKey:(id)primaryKey {
-    Class rlmObjClass = [[ARMActiveRealmManager sharedInstance] map:aClass];
+    Class rlmObjClass = [ARMModelSchema schemaForClass:aClass].realmClass;
     SEL sel = NSSelectorFromString(@"objectInRealm:forPrimaryKey:");
     IMP imp = [rlmObjClass methodForSelector:sel];
     id (*func)(id, SEL, RLMRealm *, id) =(void *) imp;
@@ -491,7 +832,28 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 
 @implementation ARMActiveRealm (Internal)
 
++ (instancetype)activeRealmWithRLMObject:(RLMObject *)obj {
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self];
+
+    ARMActiveRealm *activeRealm = [[self alloc] initForHydration];
+
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        ARMPropertyAccessorSetValue(&schema.accessors[i], activeRealm, obj[schema.propertyNames[i]]);
+    }
+
+    activeRealm->_persisted = YES;
+
+    return activeRealm;
+}
+
 - (id)objectForKeyedSubscript:(NSString *)prop {
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
+    NSUInteger slot = [schema slotForProperty:prop];
+
+    if (slot != NSNotFound) {
+        return ARMPropertyAccessorGetValue(&schema.accessors[slot], self);
+    }
+
     SEL sel = NSSelectorFromString(prop);
     IMP imp = [self methodForSelector:sel];
     id (*func)(id, SEL) = (void *) imp;
@@ -500,6 +862,15 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 }
 
 - (void)setObject:(id)obj forKeyedSubscript:(NSString *)prop {
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
+    NSUInteger slot = [schema slotForProperty:prop];
+
+    // A KVO subclass overrides setters to send notifications, so do not bypass it.
+    if (slot != NSNotFound && object_getClass(self) == schema.modelClass) {
+        ARMPropertyAccessorSetValue(&schema.accessors[slot], self, obj);
+        return;
+    }
+
     NSString *setter = [NSString stringWithFormat:@"set%@%@:",
                                                   [prop substringToIndex:1].uppercaseString,
                                                   [prop substringFromIndex:1]];
@@ -530,11 +901,14 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
 - (NSDictionary *)asDictionaryExceptingProperties:(NSArray<NSString *> *)exceptedProperties
                                             block:(id (^)(NSString *prop, id value))converter {
 
+    ARMModelSchema *schema = [ARMModelSchema schemaForClass:self.class];
     NSMutableDictionary *dictionary = [NSMutableDictionary new];
 
-    for (NSString *prop in self.class.propertyNames) {
+    for (NSUInteger i = 0; i < schema.propertyNames.count; i++) {
+        NSString *prop = schema.propertyNames[i];
+
         if (![exceptedProperties containsObject:prop]) {
-            dictionary[prop] = converter(prop, self[prop]);
+            dictionary[prop] = converter(prop, ARMPropertyAccessorGetValue(&schema.accessors[i], self));
         }
     }
 
@@ -825,6 +1199,39 @@ static NSString *const kActiveRealmPrimaryKeyName = @"uid";
     return [self.query whereWithPredicate:predicate].count;
 }
 
++ (BOOL)exists:(NSDictionary<NSString *, id> *)dictionary {
+    return [self.query where:dictionary].exists;
+}
+
++ (BOOL)existsWithPredicate:(NSPredicate *)predicate {
+    return [self.query whereWithPredicate:predicate].exists;
+}
+
++ (BOOL)existsWithID:(nullable NSString *)uid {
+    // Realm raises for a nil primary key, as in `findByID:`.
+    if (!uid) {
+        return NO;
+    }
+
+    return [self object:self forPrimaryKey:uid] != nil;
+}
+
++ (NSNumber *)sum:(NSString *)property {
+    return [self.query.all sum:property];
+}
+
++ (nullable NSNumber *)average:(NSString *)property {
+    return [self.query.all average:property];
+}
+
++ (nullable id)min:(NSString *)property {
+    return [self.query.all min:property];
+}
+
++ (nullable id)max:(NSString *)property {
+    return [self.query.all max:property];
+}
+
 @end
 
 @implementation ARMActiveRealm (Callback)
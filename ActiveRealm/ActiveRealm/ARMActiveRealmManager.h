@@ -41,6 +41,7 @@ NS_ASSUME_NONNULL_BEGIN
  *
  * Set this property if your ActiveRealm subclass has a vendor prefix and you want to get rid of
  * that vendor prefix from your ARMObject subclass.
+ * Set it before opening Realm because the indexed properties of your ARMObject subclass are resolved with it.
  */
 @property (nonatomic, copy, nullable) NSString *vendorPrefix;
 
@@ -24,11 +24,21 @@
 // SOFTWARE.
 //
 
+#import <os/lock.h>
 #import <Realm/Realm.h>
 
 #import "ARMActiveRealmManager.h"
 
-@implementation ARMActiveRealmManager
+#import "ARMModelSchema.h"
+
+@implementation ARMActiveRealmManager {
+    os_unfair_lock _lock;
+    // Caches keyed by the model class. They depend on the vendor prefix.
+    NSMapTable<Class, Class> *_mappedClasses;
+    NSMapTable<Class, NSArray<NSString *> *> *_classNames;
+    // Incremented whenever the vendor prefix changes, so that a result resolved with an old prefix is not cached.
+    NSUInteger _generation;
+}
 
 + (instancetype)sharedInstance {
     static ARMActiveRealmManager *instance = nil;
@@ -42,6 +52,9 @@
 
 - (instancetype)init {
     if (self = [super init]) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _mappedClasses = [NSMapTable strongToStrongObjectsMapTable];
+        _classNames = [NSMapTable strongToStrongObjectsMapTable];
     }
 
     return self;
@@ -53,9 +66,79 @@
     return [RLMRealm defaultRealm];
 }
 
+- (nullable NSString *)vendorPrefix {
+    os_unfair_lock_lock(&_lock);
+    NSString *vendorPrefix = _vendorPrefix;
+    os_unfair_lock_unlock(&_lock);
+
+    return vendorPrefix;
+}
+
+- (void)setVendorPrefix:(nullable NSString *)vendorPrefix {
+    os_unfair_lock_lock(&_lock);
+    _vendorPrefix = [vendorPrefix copy];
+    _generation++;
+    [_mappedClasses removeAllObjects];
+    [_classNames removeAllObjects];
+    os_unfair_lock_unlock(&_lock);
+
+    // The schemas hold the mapped classes resolved with the old prefix.
+    [ARMModelSchema removeAllSchemas];
+}
+
 #pragma mark - public method
 
 - (NSString *)stringFromClass:(Class)aClass namespace:(NSString *_Nullable *_Nullable)namespace {
+    os_unfair_lock_lock(&_lock);
+    NSArray<NSString *> *names = [_classNames objectForKey:aClass];
+    NSString *vendorPrefix = _vendorPrefix;
+    NSUInteger generation = _generation;
+    os_unfair_lock_unlock(&_lock);
+
+    if (!names) {
+        NSString *ns = nil;
+        NSString *className = [self resolveStringFromClass:aClass vendorPrefix:vendorPrefix namespace:&ns];
+        names = @[ className, ns ];
+
+        os_unfair_lock_lock(&_lock);
+        if (_generation == generation) {
+            [_classNames setObject:names forKey:aClass];
+        }
+        os_unfair_lock_unlock(&_lock);
+    }
+
+    if (namespace) {
+        *namespace = names.lastObject;
+    }
+
+    return names.firstObject;
+}
+
+- (Class)map:(Class)aClass {
+    os_unfair_lock_lock(&_lock);
+    Class arClass = [_mappedClasses objectForKey:aClass];
+    NSUInteger generation = _generation;
+    os_unfair_lock_unlock(&_lock);
+
+    if (!arClass) {
+        arClass = [self resolveMap:aClass];
+
+        os_unfair_lock_lock(&_lock);
+        if (_generation == generation) {
+            [_mappedClasses setObject:arClass forKey:aClass];
+        }
+        os_unfair_lock_unlock(&_lock);
+    }
+
+    return arClass;
+}
+
+#pragma mark - private method
+
+- (NSString *)resolveStringFromClass:(Class)aClass
+                        vendorPrefix:(nullable NSString *)vendorPrefix
+                           namespace:(NSString *_Nonnull *_Nonnull)namespace {
+
     NSString *className = NSStringFromClass(aClass);
 
     // Remove namespace of Swift class.
@@ -63,18 +146,16 @@
     className = nameComponents.lastObject;
     [nameComponents removeLastObject];
 
-    if (namespace) {
-        *namespace = [nameComponents componentsJoinedByString:@"."];
-    }
+    *namespace = [nameComponents componentsJoinedByString:@"."];
 
-    if (self.vendorPrefix.length > 0) {
-        className = [className substringFromIndex:self.vendorPrefix.length];
+    if (vendorPrefix.length > 0) {
+        className = [className substringFromIndex:vendorPrefix.length];
     }
 
     return className;
 }
 
-- (Class)map:(Class)aClass {
+- (Class)resolveMap:(Class)aClass {
     NSString *namespace = nil;
     NSString *className = [self stringFromClass:aClass namespace:&namespace];
     NSString *arClassName = [NSString stringWithFormat:@"ActiveRealm%@", className];
@@ -24,17 +24,22 @@
 // SOFTWARE.
 //
 
-#import <Foundation/Foundation.h>
-
-#import <Realm/Realm.h>
+#import "ARMCollection.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface ARMObject : RLMObject
+@class RLMSortDescriptor;
+
+@interface ARMCollection (Internal)
 
-@property NSString *uid;
-@property NSDate *createdAt;
-@property NSDate *updatedAt;
+/**
+ * Appends `createdAt` ascending and `uid` ascending to specified sort descriptors, so that the order is stable and
+ * every object has a distinct position. A later descriptor for the key path of an earlier one is dropped.
+ *
+ * @param sortDescriptors Sort descriptors.
+ * @return The sort descriptors applied when reading models in order.
+ */
++ (NSArray<RLMSortDescriptor *> *)resolvedSortDescriptors:(NSArray<RLMSortDescriptor *> *)sortDescriptors;
 
 @end
 
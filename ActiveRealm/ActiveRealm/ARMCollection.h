@@ -29,13 +29,24 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ARMActiveRealm;
+@class ARMColumn;
+@class ARMCursor;
+@class ARMGroup;
 @class RLMResults;
+@class RLMSortDescriptor;
 
 @interface ARMCollection : NSObject
 /**
  * The models in the collection.
  */
 @property (nonatomic, copy, readonly) NSArray<__kindof ARMActiveRealm *> *toArray;
+/**
+ * The models in the collection hydrated on access. Unlike `toArray`, the models are not built in advance, so the cost
+ * is proportional to the number of accessed models. The array is a snapshot of the collection and can be passed to
+ * other threads, unless it is taken in a write transaction. The snapshot keeps its Realm version while the array is
+ * alive. Accessing an index returns the same model as long as a caller holds it, otherwise a newly hydrated one.
+ */
+@property (nonatomic, readonly) NSArray<__kindof ARMActiveRealm *> *toLazyArray;
 /**
  * The first model in the collection.
  */
@@ -48,6 +59,10 @@ NS_ASSUME_NONNULL_BEGIN
  * The number of models in the collection.
  */
 @property (nonatomic, readonly) NSUInteger count;
+/**
+ * Whether the collection has any models. Unlike `count`, it stops at the first match.
+ */
+@property (nonatomic, readonly) BOOL exists;
 
 - (instancetype)initWithClass:(Class)aClass results:(RLMResults *)results;
 
@@ -59,6 +74,15 @@ NS_ASSUME_NONNULL_BEGIN
  * @return The collection.
  */
 - (instancetype)order:(NSString *)property ascending:(BOOL)ascending;
+/**
+ * Sorts objects in the collection by specified sort descriptors. The first descriptor takes precedence.
+ * If the collection has been sorted, the new order takes precedence and the previous orders break ties.
+ * The models are sorted by `createdAt` ascending unless specified.
+ *
+ * @param sortDescriptors Sort descriptors.
+ * @return The collection.
+ */
+- (instancetype)order:(NSArray<RLMSortDescriptor *> *)sortDescriptors;
 /**
  * Returns specified number of the models from the head.
  *
@@ -73,6 +97,71 @@ NS_ASSUME_NONNULL_BEGIN
  * @return Objects of the model.
  */
 - (NSArray<__kindof ARMActiveRealm *> *)lastWithLimit:(NSUInteger)limit NS_SWIFT_NAME(last(limit:));
+/**
+ * Returns specified number of the models from specified offset. Only the models in the page are built.
+ *
+ * @param offset The index of the first model.
+ * @param limit Maximum number of acquisitions.
+ * @return Objects of the model.
+ */
+- (NSArray<__kindof ARMActiveRealm *> *)pageWithOffset:(NSUInteger)offset
+                                                 limit:(NSUInteger)limit NS_SWIFT_NAME(page(offset:limit:));
+/**
+ * Returns specified number of the models after the cursor. Unlike an offset, the cursor is not shifted by objects
+ * inserted or deleted before it, so pages do not overlap or skip objects while the DB is written.
+ *
+ * The position of the cursor is found by a binary search of the sorted objects, so a page costs O(log n) comparisons
+ * plus building the models in the page.
+ *
+ * @param cursor A cursor made from the last model of the previous page, or nil for the first page.
+ * @param limit Maximum number of acquisitions.
+ * @return Objects of the model.
+ */
+- (NSArray<__kindof ARMActiveRealm *> *)pageAfter:(nullable ARMCursor *)cursor
+                                            limit:(NSUInteger)limit NS_SWIFT_NAME(page(after:limit:));
+/**
+ * Returns the cursor pointing at specified model in the current order of the collection.
+ * The cursor can be used only for a collection in the same order.
+ *
+ * @param object A model.
+ * @return The cursor.
+ */
+- (ARMCursor *)cursorForObject:(ARMActiveRealm *)object NS_SWIFT_NAME(cursor(for:));
+/**
+ * Groups the models by specified property and counts them. No models are built.
+ *
+ * @param property A property.
+ * @return The groups sorted by key ascending.
+ */
+- (NSArray<ARMGroup *> *)groupBy:(NSString *)property;
+/**
+ * Groups the models by specified property, and counts and aggregates them. No models are built.
+ *
+ * @param property A property.
+ * @param aggregatedProperty A property to aggregate in each group.
+ * @return The groups sorted by key ascending.
+ */
+- (NSArray<ARMGroup *> *)groupBy:(NSString *)property
+                     aggregating:(NSString *)aggregatedProperty NS_SWIFT_NAME(groupBy(_:aggregating:));
+/**
+ * Returns the collection that has one model for each distinct combination of values of specified properties.
+ * The model kept for each combination is the first one in the current order of the collection.
+ *
+ * @param properties Properties.
+ * @return A new collection.
+ */
+- (ARMCollection *)distinct:(NSArray<NSString *> *)properties;
+/**
+ * Enumerates the models in the collection by specified number. Only the models in a batch are alive at once, so the
+ * memory does not grow with the size of the collection. The batch array is reused, so copy it to keep the models
+ * after the block returns.
+ *
+ * @param batchSize The number of models in a batch. Raises NSInvalidArgumentException if it is 0.
+ * @param block The block called with each batch. Set YES to `stop` to stop the enumeration.
+ */
+- (void)enumerateInBatchesOfSize:(NSUInteger)batchSize
+                      usingBlock:(void (^)(NSArray<__kindof ARMActiveRealm *> *batch, BOOL *stop))block
+    NS_SWIFT_NAME(enumerate(batchSize:using:));
 /**
  * Retrieves an object at given index.
  *
@@ -87,6 +176,64 @@ NS_ASSUME_NONNULL_BEGIN
  * @return Property array.
  */
 - (NSArray *)pluck:(NSArray<NSString *> *)properties;
+/**
+ * Plucks a property of the models into a buffer of int64_t. Floating point values are truncated.
+ *
+ * @param property A property of int, bool, float or double type.
+ * @return The column.
+ */
+- (ARMColumn *)pluckInt64:(NSString *)property;
+/**
+ * Plucks a property of the models into a buffer of double.
+ *
+ * @param property A property of int, bool, float or double type.
+ * @return The column.
+ */
+- (ARMColumn *)pluckDouble:(NSString *)property;
+/**
+ * Plucks a property of the models into a buffer of double of the seconds since 1970.
+ *
+ * @param property A property of date type.
+ * @return The column.
+ */
+- (ARMColumn *)pluckDates:(NSString *)property;
+/**
+ * Plucks properties of the models into a buffer per property, reading each object once.
+ *
+ * @param types ARMColumnType values keyed by property name.
+ * @return The columns keyed by property name.
+ */
+- (NSDictionary<NSString *, ARMColumn *> *)pluckColumns:(NSDictionary<NSString *, NSNumber *> *)types;
+/**
+ * Returns the sum of specified property of the models. It is calculated by Realm without building the models.
+ *
+ * @param property A property of int, float, double or decimal type.
+ * @return The sum. 0 if the collection is empty.
+ */
+- (NSNumber *)sum:(NSString *)property;
+/**
+ * Returns the average of specified property of the models. It is calculated by Realm without building the models.
+ *
+ * @param property A property of int, float, double or decimal type.
+ * @return The average, or nil if the collection is empty.
+ */
+- (nullable NSNumber *)average:(NSString *)property;
+/**
+ * Returns the minimum value of specified property of the models. It is calculated by Realm without building the
+ * models.
+ *
+ * @param property A property of int, float, double, decimal or date type.
+ * @return The minimum value, or nil if the collection is empty.
+ */
+- (nullable id)min:(NSString *)property;
+/**
+ * Returns the maximum value of specified property of the models. It is calculated by Realm without building the
+ * models.
+ *
+ * @param property A property of int, float, double, decimal or date type.
+ * @return The maximum value, or nil if the collection is empty.
+ */
+- (nullable id)max:(NSString *)property;
 
 - (__kindof ARMActiveRealm *)objectAtIndexedSubscript:(NSUInteger)idx;
 
@@ -27,23 +27,52 @@
 #import <Realm/Realm.h>
 
 #import "ARMCollection.h"
+#import "ARMCollection+Internal.h"
 
 #import "ARMActiveRealm.h"
 #import "ARMActiveRealm+Internal.h"
-#import "ARMRelation.h"
-#import "ARMRelation+Internal.h"
-#import "ARMRelationship.h"
+#import "ARMColumn.h"
+#import "ARMColumn+Internal.h"
+#import "ARMCursor.h"
+#import "ARMGroup.h"
+#import "ARMGroup+Internal.h"
+#import "ARMLazyArray.h"
+#import "ARMModelSchema.h"
+
+/**
+ * Compares two values of a sort key in the same order as Realm sorts them.
+ */
+static NSComparisonResult ARMCompareSortValues(id _Nullable value, id _Nullable other) {
+    // nil comes first in ascending order.
+    if (!value || !other) {
+        return value == other ? NSOrderedSame : (value ? NSOrderedDescending : NSOrderedAscending);
+    }
 
-@interface ARMActiveRealm ()
+    // Realm sorts strings by their UTF-8 bytes, not by the locale.
+    if ([value isKindOfClass:[NSString class]] && [other isKindOfClass:[NSString class]]) {
+        int result = strcmp([value UTF8String], [other UTF8String]);
 
-@property (nonatomic, copy) NSDictionary<NSString *, ARMRelation *> *relations;
+        return result < 0 ? NSOrderedAscending : (result > 0 ? NSOrderedDescending : NSOrderedSame);
+    }
 
-@end
+    return [value compare:other];
+}
 
 @interface ARMCollection ()
 
 @property (nonatomic) Class modelClass;
+/**
+ * The unsorted results.
+ */
 @property (nonatomic) RLMResults *results;
+/**
+ * The sort descriptors specified by `order:`. The first one is the primary key of the sort.
+ */
+@property (nonatomic) NSMutableArray<RLMSortDescriptor *> *sortDescriptors;
+/**
+ * The results sorted by the sort descriptors. Created on first use.
+ */
+@property (nonatomic, nullable) RLMResults *sortedResults;
 
 @end
 
@@ -54,7 +83,8 @@
 
     if (self) {
         _modelClass = aClass;
-        _results = [results sortedResultsUsingKeyPath:@"createdAt" ascending:YES];
+        _results = results;
+        _sortDescriptors = [NSMutableArray new];
     }
 
     return self;
@@ -65,64 +95,76 @@
 - (NSArray<__kindof ARMActiveRealm *> *)toArray {
     NSMutableArray<ARMActiveRealm *> *array = [NSMutableArray new];
 
-    for (RLMObject *obj in self.results) {
+    for (RLMObject *obj in self.orderedResults) {
         [array addObject:[self activeRealmFromRLMObject:obj]];
     }
 
     return array;
 }
 
+- (NSArray<__kindof ARMActiveRealm *> *)toLazyArray {
+    // Frozen results do not change and can be read on any thread. A Realm can not be frozen in a write transaction.
+    RLMResults *results = self.orderedResults;
+    results = results.realm.inWriteTransaction ? results : [results freeze];
+
+    return [[ARMLazyArray alloc] initWithClass:self.modelClass results:results];
+}
+
 - (nullable __kindof ARMActiveRealm *)first {
-    return self.results.firstObject ? [self activeRealmFromRLMObject:self.results.firstObject] : nil;
+    return self.orderedResults.firstObject ? [self activeRealmFromRLMObject:self.orderedResults.firstObject] : nil;
 }
 
 - (nullable __kindof ARMActiveRealm *)last {
-    return self.results.lastObject ? [self activeRealmFromRLMObject:self.results.lastObject] : nil;
+    return self.orderedResults.lastObject ? [self activeRealmFromRLMObject:self.orderedResults.lastObject] : nil;
 }
 
 - (NSUInteger)count {
     return self.results.count;
 }
 
+- (BOOL)exists {
+    // The first object of unsorted results is found without evaluating the rest of the query.
+    return self.results.firstObject != nil;
+}
+
 - (instancetype)order:(NSString *)property ascending:(BOOL)ascending {
-    self.results = [self.results sortedResultsUsingKeyPath:property ascending:ascending];
+    return [self order:@[ [RLMSortDescriptor sortDescriptorWithKeyPath:property ascending:ascending] ]];
+}
+
+- (instancetype)order:(NSArray<RLMSortDescriptor *> *)sortDescriptors {
+    // Same as chained sorts of Realm, the latest order takes precedence and the previous orders break ties.
+    NSIndexSet *indexes = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, sortDescriptors.count)];
+    [self.sortDescriptors insertObjects:sortDescriptors atIndexes:indexes];
+    self.sortedResults = nil;
+
     return self;
 }
 
 - (NSArray<__kindof ARMActiveRealm *> *)firstWithLimit:(NSUInteger)limit {
-    NSArray *results = self.toArray;
+    NSUInteger count = self.orderedResults.count;
 
-    if (results.count <= limit) {
-        return results;
-    }
-
-    return [results subarrayWithRange:NSMakeRange(0, limit)];
+    return [self modelsInRange:NSMakeRange(0, MIN(limit, count))];
 }
 
 - (NSArray<__kindof ARMActiveRealm *> *)lastWithLimit:(NSUInteger)limit {
-    NSArray *results = self.toArray;
-
-    if (results.count <= limit) {
-        return results;
-    }
+    NSUInteger count = self.orderedResults.count;
+    NSUInteger length = MIN(limit, count);
 
-    results = [results.reverseObjectEnumerator.allObjects subarrayWithRange:NSMakeRange(0, limit)];
-
-    return results.reverseObjectEnumerator.allObjects;
+    return [self modelsInRange:NSMakeRange(count - length, length)];
 }
 
 - (nullable __kindof ARMActiveRealm *)objectAtIndex:(NSUInteger)idx {
-    if (self.results.count <= idx) {
+    if (self.orderedResults.count <= idx) {
         return nil;
     }
 
-    return [self activeRealmFromRLMObject:self.results[idx]];
+    return [self activeRealmFromRLMObject:self.orderedResults[idx]];
 }
 
 - (NSArray *)pluck:(NSArray<NSString *> *)properties {
     NSMutableArray *array = [NSMutableArray new];
 
-    for (RLMObject *obj in self.results) {
+    for (RLMObject *obj in self.orderedResults) {
         if (properties.count == 1) {
             id value = obj[properties.firstObject];
 
@@ -145,30 +187,233 @@
     return array;
 }
 
+- (NSArray<__kindof ARMActiveRealm *> *)pageWithOffset:(NSUInteger)offset limit:(NSUInteger)limit {
+    NSUInteger count = self.orderedResults.count;
+
+    if (count <= offset) {
+        return @[];
+    }
+
+    return [self modelsInRange:NSMakeRange(offset, MIN(limit, count - offset))];
+}
+
+- (NSArray<__kindof ARMActiveRealm *> *)pageAfter:(nullable ARMCursor *)cursor limit:(NSUInteger)limit {
+    if (!cursor) {
+        return [self firstWithLimit:limit];
+    }
+
+    NSArray<RLMSortDescriptor *> *sortDescriptors = self.resolvedSortDescriptors;
+
+    if (![[cursor.sortDescriptors valueForKey:@"keyPath"] isEqual:[sortDescriptors valueForKey:@"keyPath"]] ||
+        ![[cursor.sortDescriptors valueForKey:@"ascending"] isEqual:[sortDescriptors valueForKey:@"ascending"]]) {
+
+        [NSException raise:NSInvalidArgumentException format:@"The cursor was made from a collection in other order."];
+    }
+
+    RLMResults *results = self.orderedResults;
+    NSUInteger count = results.count;
+    NSUInteger location = [self indexOfFirstObjectInResults:results afterCursor:cursor];
+
+    return [self modelsFromResults:results inRange:NSMakeRange(location, MIN(limit, count - location))];
+}
+
+- (ARMCursor *)cursorForObject:(ARMActiveRealm *)object {
+    NSArray<RLMSortDescriptor *> *sortDescriptors = self.resolvedSortDescriptors;
+    NSMutableArray *values = [NSMutableArray new];
+
+    for (RLMSortDescriptor *sortDescriptor in sortDescriptors) {
+        [values addObject:[object valueForKey:sortDescriptor.keyPath] ?: [NSNull null]];
+    }
+
+    return [ARMCursor cursorWithSortDescriptors:sortDescriptors values:values];
+}
+
+- (ARMColumn *)pluckInt64:(NSString *)property {
+    return [self pluckColumns:@{ property: @(ARMColumnTypeInt64) }][property];
+}
+
+- (ARMColumn *)pluckDouble:(NSString *)property {
+    return [self pluckColumns:@{ property: @(ARMColumnTypeDouble) }][property];
+}
+
+- (ARMColumn *)pluckDates:(NSString *)property {
+    return [self pluckColumns:@{ property: @(ARMColumnTypeDate) }][property];
+}
+
+- (NSDictionary<NSString *, ARMColumn *> *)pluckColumns:(NSDictionary<NSString *, NSNumber *> *)types {
+    return [ARMColumn columnsFromResults:self.orderedResults
+                              realmClass:[ARMModelSchema schemaForClass:self.modelClass].realmClass
+                                   types:types];
+}
+
+- (NSNumber *)sum:(NSString *)property {
+    return [self.results sumOfProperty:property];
+}
+
+- (nullable NSNumber *)average:(NSString *)property {
+    return [self.results averageOfProperty:property];
+}
+
+- (nullable id)min:(NSString *)property {
+    return [self.results minOfProperty:property];
+}
+
+- (nullable id)max:(NSString *)property {
+    return [self.results maxOfProperty:property];
+}
+
+- (NSArray<ARMGroup *> *)groupBy:(NSString *)property {
+    return [ARMGroup groupsFromResults:self.results byProperty:property aggregating:nil];
+}
+
+- (NSArray<ARMGroup *> *)groupBy:(NSString *)property aggregating:(NSString *)aggregatedProperty {
+    return [ARMGroup groupsFromResults:self.results byProperty:property aggregating:aggregatedProperty];
+}
+
+- (ARMCollection *)distinct:(NSArray<NSString *> *)properties {
+    // Realm keeps the first object of each combination in the order of the results, so deduplicate sorted ones.
+    RLMResults *results = [self.orderedResults distinctResultsUsingKeyPaths:properties];
+    ARMCollection *collection = [[ARMCollection alloc] initWithClass:self.modelClass results:results];
+    [collection.sortDescriptors addObjectsFromArray:self.sortDescriptors];
+
+    return collection;
+}
+
+- (void)enumerateInBatchesOfSize:(NSUInteger)batchSize
+                      usingBlock:(void (^)(NSArray<__kindof ARMActiveRealm *> *batch, BOOL *stop))block {
+
+    // A zero size would never advance the enumeration. Assertions are compiled out in release builds.
+    if (batchSize == 0) {
+        [NSException raise:NSInvalidArgumentException format:@"The batch size must be greater than 0."];
+    }
+
+    // Objects written by the block do not shift the rest of the enumeration.
+    RLMResults *results = self.orderedResults;
+    results = results.realm.inWriteTransaction ? results : [results freeze];
+
+    NSUInteger count = results.count;
+    NSMutableArray<ARMActiveRealm *> *batch = [NSMutableArray arrayWithCapacity:batchSize];
+    BOOL stop = NO;
+
+    for (NSUInteger location = 0; location < count && !stop; location += batchSize) {
+        @autoreleasepool {
+            for (NSUInteger i = location; i < MIN(location + batchSize, count); i++) {
+                [batch addObject:[self activeRealmFromRLMObject:results[i]]];
+            }
+
+            block(batch, &stop);
+            [batch removeAllObjects];
+        }
+    }
+}
+
 - (__kindof ARMActiveRealm *)objectAtIndexedSubscript:(NSUInteger)idx {
-    return [self activeRealmFromRLMObject:self.results[idx]];
+    return [self activeRealmFromRLMObject:self.orderedResults[idx]];
 }
 
 #pragma mark - private method
 
-- (ARMActiveRealm *)activeRealmFromRLMObject:(RLMObject *)obj {
-    ARMActiveRealm *activeRealm = (ARMActiveRealm *) [self.modelClass new];
+/**
+ * The sort descriptors applied when reading models in order. They are specified orders followed by the defaults.
+ */
+- (NSArray<RLMSortDescriptor *> *)resolvedSortDescriptors {
+    return [ARMCollection resolvedSortDescriptors:self.sortDescriptors];
+}
 
-    for (NSString *prop in [self.modelClass propertyNames]) {
-        activeRealm[prop] = obj[prop];
+/**
+ * The results sorted by `resolvedSortDescriptors`. Only the operations that read models in order use it.
+ */
+- (RLMResults *)orderedResults {
+    if (!self.sortedResults) {
+        self.sortedResults = [self.results sortedResultsUsingDescriptors:self.resolvedSortDescriptors];
     }
 
-    NSMutableDictionary<NSString *, ARMRelation *> *relations = [NSMutableDictionary new];
+    return self.sortedResults;
+}
 
-    NSDictionary<NSString *, ARMRelationship *> *definedRelationships = [self.modelClass definedRelationships];
+/**
+ * Hydrates only the models in specified range of the ordered results.
+ */
+- (NSArray<__kindof ARMActiveRealm *> *)modelsInRange:(NSRange)range {
+    return [self modelsFromResults:self.orderedResults inRange:range];
+}
 
-    for (NSString *prop in definedRelationships) {
-        relations[prop] = [ARMRelation relationWithObject:activeRealm relationship:definedRelationships[prop]];
+- (NSArray<__kindof ARMActiveRealm *> *)modelsFromResults:(RLMResults *)results inRange:(NSRange)range {
+    NSMutableArray<ARMActiveRealm *> *array = [NSMutableArray arrayWithCapacity:range.length];
+
+    for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+        [array addObject:[self activeRealmFromRLMObject:results[i]]];
+    }
+
+    return array;
+}
+
+/**
+ * Returns the index of the first object ordered after the cursor, or the count if there is none. The results must be
+ * sorted by the sort descriptors of the cursor.
+ */
+- (NSUInteger)indexOfFirstObjectInResults:(RLMResults *)results afterCursor:(ARMCursor *)cursor {
+    NSUInteger low = 0;
+    NSUInteger high = results.count;
+
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+
+        if ([self isObject:results[mid] afterCursor:cursor]) {
+            high = mid;
+        }
+        else {
+            low = mid + 1;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * Compares an object with the cursor by all sort keys in memory.
+ */
+- (BOOL)isObject:(RLMObject *)obj afterCursor:(ARMCursor *)cursor {
+    for (NSUInteger i = 0; i < cursor.sortDescriptors.count; i++) {
+        RLMSortDescriptor *sortDescriptor = cursor.sortDescriptors[i];
+        id value = obj[sortDescriptor.keyPath];
+        id cursorValue = cursor.values[i] != [NSNull null] ? cursor.values[i] : nil;
+        NSComparisonResult result = ARMCompareSortValues(value, cursorValue);
+
+        if (result != NSOrderedSame) {
+            return sortDescriptor.ascending ? result == NSOrderedDescending : result == NSOrderedAscending;
+        }
     }
 
-    activeRealm.relations = relations;
+    // The object is the one of the cursor.
+    return NO;
+}
+
+- (ARMActiveRealm *)activeRealmFromRLMObject:(RLMObject *)obj {
+    return [self.modelClass activeRealmWithRLMObject:obj];
+}
+
+@end
+
+@implementation ARMCollection (Internal)
+
++ (NSArray<RLMSortDescriptor *> *)resolvedSortDescriptors:(NSArray<RLMSortDescriptor *> *)sortDescriptors {
+    NSMutableArray<RLMSortDescriptor *> *resolved = [NSMutableArray new];
+    NSMutableSet<NSString *> *keyPaths = [NSMutableSet new];
+    NSArray<RLMSortDescriptor *> *defaults = @[
+        [RLMSortDescriptor sortDescriptorWithKeyPath:@"createdAt" ascending:YES],
+        [RLMSortDescriptor sortDescriptorWithKeyPath:@"uid" ascending:YES]
+    ];
+
+    for (RLMSortDescriptor *sortDescriptor in [sortDescriptors arrayByAddingObjectsFromArray:defaults]) {
+        // An earlier descriptor for the same key path already decides the order.
+        if (![keyPaths containsObject:sortDescriptor.keyPath]) {
+            [resolved addObject:sortDescriptor];
+            [keyPaths addObject:sortDescriptor.keyPath];
+        }
+    }
 
-    return activeRealm;
+    return resolved;
 }
 
 @end
@@ -24,17 +24,25 @@
 // SOFTWARE.
 //
 
-#import <Foundation/Foundation.h>
-
-#import <Realm/Realm.h>
+#import "ARMColumn.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface ARMObject : RLMObject
+@class RLMResults;
+
+@interface ARMColumn (Internal)
 
-@property NSString *uid;
-@property NSDate *createdAt;
-@property NSDate *updatedAt;
+/**
+ * Packs the values of specified properties of the results in one pass.
+ *
+ * @param results The results.
+ * @param realmClass The ARMObject subclass of the results.
+ * @param types The column types keyed by property name.
+ * @return The columns keyed by property name.
+ */
++ (NSDictionary<NSString *, ARMColumn *> *)columnsFromResults:(RLMResults *)results
+                                                   realmClass:(Class)realmClass
+                                                        types:(NSDictionary<NSString *, NSNumber *> *)types;
 
 @end
 
@@ -0,0 +1,163 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, ARMColumnType) {
+    /**
+     * The values are packed as int64_t.
+     */
+    ARMColumnTypeInt64 = 0,
+    /**
+     * The values are packed as double.
+     */
+    ARMColumnTypeDouble,
+    /**
+     * The values are packed as double of the seconds since 1970 (`timeIntervalSince1970`).
+     */
+    ARMColumnTypeDate,
+};
+
+/**
+ * The values of a property of the models packed into a contiguous buffer. A null value is stored as 0 and marked in
+ * the null bitmap.
+ */
+@interface ARMColumn : NSObject
+/**
+ * The property name.
+ */
+@property (nonatomic, copy, readonly) NSString *property;
+/**
+ * The type of the values.
+ */
+@property (nonatomic, readonly) ARMColumnType type;
+/**
+ * The number of the values.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+/**
+ * The number of null values.
+ */
+@property (nonatomic, readonly) NSUInteger nullCount;
+/**
+ * The packed values. The element is int64_t if the type is ARMColumnTypeInt64, otherwise double.
+ */
+@property (nonatomic, readonly) NSData *values;
+/**
+ * The bitmap of null values. The bit `i % 8` of the byte `i / 8` is set if the value at `i` is null.
+ */
+@property (nonatomic, readonly) NSData *nullBitmap;
+/**
+ * The values as int64_t, or NULL if the type is not ARMColumnTypeInt64.
+ */
+@property (nonatomic, nullable, readonly) const int64_t *int64Values NS_RETURNS_INNER_POINTER;
+/**
+ * The values as double, or NULL if the type is ARMColumnTypeInt64.
+ */
+@property (nonatomic, nullable, readonly) const double *doubleValues NS_RETURNS_INNER_POINTER;
+
+/**
+ * Returns whether the value at given index is null.
+ *
+ * @param idx An index.
+ * @return YES if the value is null.
+ */
+- (BOOL)isNullAtIndex:(NSUInteger)idx NS_SWIFT_NAME(isNull(at:));
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ * Statistics over the values of a column. Null values are skipped. The values of an int64 column are calculated as
+ * double. The kernels use SIMD instructions where <simd/simd.h> is available, otherwise scalar code.
+ */
+@interface ARMColumn (Statistics)
+/**
+ * Returns the sum of the values.
+ *
+ * @return The sum. 0 if there are no values.
+ */
+- (double)sum;
+/**
+ * Returns the sum of the values whose bits are set in the mask.
+ *
+ * @param mask A bitmap in the same layout as `nullBitmap`. The bit of a value to add is set.
+ *             Raises NSInvalidArgumentException if it is shorter than `nullBitmap`.
+ * @return The sum. 0 if there are no values.
+ */
+- (double)sumWithMask:(NSData *)mask NS_SWIFT_NAME(sum(mask:));
+/**
+ * Returns the minimum value.
+ *
+ * @return The minimum value, or NAN if there are no values.
+ */
+- (double)minimum;
+/**
+ * Returns the maximum value.
+ *
+ * @return The maximum value, or NAN if there are no values.
+ */
+- (double)maximum;
+/**
+ * Returns the mean of the values.
+ *
+ * @return The mean, or NAN if there are no values.
+ */
+- (double)mean;
+/**
+ * Returns the population variance of the values.
+ *
+ * @return The variance, or NAN if there are no values.
+ */
+- (double)variance;
+/**
+ * Returns the values at specified fractions of the sorted values. The values between ranks are interpolated linearly.
+ *
+ * @param fractions Fractions from 0 to 1. For example, 0.5 is the median.
+ * @return The percentiles in the same order as `fractions`. NAN if there are no values.
+ */
+- (NSArray<NSNumber *> *)percentiles:(NSArray<NSNumber *> *)fractions;
+/**
+ * Counts the values in buckets of the same width between specified range. The values out of the range are not
+ * counted, and the maximum is counted in the last bucket.
+ *
+ * @param bucketCount The number of buckets. Raises NSInvalidArgumentException if it is 0.
+ * @param minimum The lower bound of the first bucket.
+ * @param maximum The upper bound of the last bucket. Raises NSInvalidArgumentException if it is not greater than
+ *                `minimum`.
+ * @return The numbers of the values in the buckets.
+ */
+- (NSArray<NSNumber *> *)histogramWithBucketCount:(NSUInteger)bucketCount
+                                          minimum:(double)minimum
+                                          maximum:(double)maximum
+    NS_SWIFT_NAME(histogram(bucketCount:minimum:maximum:));
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,563 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <objc/runtime.h>
+
+#if __has_include(<simd/simd.h>)
+#import <simd/simd.h>
+#define ARM_COLUMN_SIMD 1
+#else
+#define ARM_COLUMN_SIMD 0
+#endif
+
+#import <Realm/Realm.h>
+
+#import "ARMColumn.h"
+#import "ARMColumn+Internal.h"
+
+/**
+ * The number of rows read in an autorelease pool. The values of object properties are boxed temporarily.
+ */
+static const NSUInteger kColumnRowsPerPool = 4096;
+
+@implementation ARMColumn {
+    NSMutableData *_packedValues;
+    NSMutableData *_packedNullBitmap;
+    // The getter of a primitive property. It is called directly so that the value is not boxed.
+    SEL _getter;
+    char _encoding;
+    Class _getterClass;
+    IMP _getterIMP;
+}
+
+- (instancetype)initWithProperty:(NSString *)property
+                            type:(ARMColumnType)type
+                           count:(NSUInteger)count
+                      realmClass:(Class)realmClass {
+
+    self = [super init];
+
+    if (self) {
+        _property = [property copy];
+        _type = type;
+        _count = count;
+        _packedValues = [NSMutableData dataWithLength:count * sizeof(int64_t)];
+        _packedNullBitmap = [NSMutableData dataWithLength:(count + 7) / 8];
+
+        objc_property_t prop = class_getProperty(realmClass, property.UTF8String);
+        char *encoding = prop ? property_copyAttributeValue(prop, "T") : NULL;
+
+        if (encoding && encoding[1] == '\0' && strchr("cislqCISLQBfd", encoding[0])) {
+            char *getter = property_copyAttributeValue(prop, "G");
+            _getter = sel_registerName(getter ?: property.UTF8String);
+            _encoding = encoding[0];
+            free(getter);
+        }
+
+        free(encoding);
+    }
+
+    return self;
+}
+
+#pragma mark - property
+
+- (NSData *)values {
+    return _packedValues;
+}
+
+- (NSData *)nullBitmap {
+    return _packedNullBitmap;
+}
+
+- (nullable const int64_t *)int64Values {
+    return self.type == ARMColumnTypeInt64 ? _packedValues.bytes : NULL;
+}
+
+- (nullable const double *)doubleValues {
+    return self.type != ARMColumnTypeInt64 ? _packedValues.bytes : NULL;
+}
+
+#pragma mark - public method
+
+- (BOOL)isNullAtIndex:(NSUInteger)idx {
+    NSParameterAssert(idx < self.count);
+
+    return (((const uint8_t *) _packedNullBitmap.bytes)[idx / 8] >> (idx % 8)) & 1;
+}
+
+- (NSString *)description {
+    return @{
+        @"property": self.property,
+        @"type": @(self.type),
+        @"count": @(self.count),
+        @"nullCount": @(self.nullCount)
+    }.description;
+}
+
+#pragma mark - private method
+
+- (void)readObject:(RLMObject *)obj atIndex:(NSUInteger)idx {
+    if (_encoding) {
+        Class aClass = object_getClass(obj);
+
+        if (aClass != _getterClass) {
+            _getterClass = aClass;
+            _getterIMP = class_getMethodImplementation(aClass, _getter);
+        }
+
+        switch (_encoding) {
+            case 'f':
+                [self setDouble:((float (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'd':
+                [self setDouble:((double (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'B':
+                [self setInt64:((bool (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'c':
+                [self setInt64:((char (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'C':
+                [self setInt64:((unsigned char (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 's':
+                [self setInt64:((short (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'S':
+                [self setInt64:((unsigned short (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'i':
+                [self setInt64:((int (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'I':
+                [self setInt64:((unsigned int (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'l':
+                [self setInt64:((long (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'L':
+                [self setInt64:(int64_t) ((unsigned long (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'q':
+                [self setInt64:((long long (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            case 'Q':
+                [self setInt64:(int64_t) ((unsigned long long (*)(id, SEL)) _getterIMP)(obj, _getter) atIndex:idx];
+                break;
+            default:
+                break;
+        }
+
+        return;
+    }
+
+    id value = obj[self.property];
+
+    if ([value isKindOfClass:[NSDate class]]) {
+        [self setDouble:((NSDate *) value).timeIntervalSince1970 atIndex:idx];
+    }
+    else if ([value isKindOfClass:[NSNumber class]]) {
+        const char *objCType = ((NSNumber *) value).objCType;
+
+        if (objCType[0] == 'f' || objCType[0] == 'd') {
+            [self setDouble:((NSNumber *) value).doubleValue atIndex:idx];
+        }
+        else {
+            [self setInt64:((NSNumber *) value).longLongValue atIndex:idx];
+        }
+    }
+    else {
+        ((uint8_t *) _packedNullBitmap.mutableBytes)[idx / 8] |= (uint8_t) (1 << (idx % 8));
+        _nullCount++;
+    }
+}
+
+- (void)setInt64:(int64_t)value atIndex:(NSUInteger)idx {
+    if (self.type == ARMColumnTypeInt64) {
+        ((int64_t *) _packedValues.mutableBytes)[idx] = value;
+    }
+    else {
+        ((double *) _packedValues.mutableBytes)[idx] = (double) value;
+    }
+}
+
+- (void)setDouble:(double)value atIndex:(NSUInteger)idx {
+    if (self.type == ARMColumnTypeInt64) {
+        ((int64_t *) _packedValues.mutableBytes)[idx] = (int64_t) value;
+    }
+    else {
+        ((double *) _packedValues.mutableBytes)[idx] = value;
+    }
+}
+
+@end
+
+@implementation ARMColumn (Internal)
+
++ (NSDictionary<NSString *, ARMColumn *> *)columnsFromResults:(RLMResults *)results
+                                                   realmClass:(Class)realmClass
+                                                        types:(NSDictionary<NSString *, NSNumber *> *)types {
+
+    NSUInteger count = results.count;
+    NSMutableDictionary<NSString *, ARMColumn *> *columns = [NSMutableDictionary new];
+
+    for (NSString *prop in types) {
+        columns[prop] = [[ARMColumn alloc] initWithProperty:prop
+                                                       type:(ARMColumnType) types[prop].integerValue
+                                                      count:count
+                                                 realmClass:realmClass];
+    }
+
+    NSArray<ARMColumn *> *targets = columns.allValues;
+
+    for (NSUInteger location = 0; location < count; location += kColumnRowsPerPool) {
+        @autoreleasepool {
+            for (NSUInteger i = location; i < MIN(location + kColumnRowsPerPool, count); i++) {
+                RLMObject *obj = results[i];
+
+                for (ARMColumn *column in targets) {
+                    [column readObject:obj atIndex:i];
+                }
+            }
+        }
+    }
+
+    return columns;
+}
+
+@end
+
+/**
+ * The result of a pass over the values.
+ */
+typedef struct {
+    NSUInteger count;
+    double sum;
+    double min;
+    double max;
+} ARMColumnSummary;
+
+NS_INLINE double ARMColumnValue(const void *values, bool int64, NSUInteger idx) {
+    return int64 ? (double) ((const int64_t *) values)[idx] : ((const double *) values)[idx];
+}
+
+#if ARM_COLUMN_SIMD
+
+NS_INLINE simd_double4 ARMColumnLoad4(const void *values, bool int64, NSUInteger idx) {
+    if (int64) {
+        return simd_double((simd_long4) *(const simd_packed_long4 *) ((const int64_t *) values + idx));
+    }
+
+    return *(const simd_packed_double4 *) ((const double *) values + idx);
+}
+
+#endif
+
+/**
+ * Returns the bits of the values to skip in the block of 8 values.
+ */
+NS_INLINE uint8_t ARMColumnExcludedBits(const uint8_t *nulls, const uint8_t *_Nullable mask, NSUInteger block) {
+    return nulls[block] | (mask ? (uint8_t) ~mask[block] : 0);
+}
+
+/**
+ * Sums up the values and finds the minimum and the maximum in one pass. The values are processed in blocks of 8 that
+ * match a byte of the bitmaps. A block without skipped values is processed by SIMD instructions.
+ */
+static ARMColumnSummary ARMColumnSummarize(const void *values,
+                                           bool int64,
+                                           NSUInteger count,
+                                           const uint8_t *nulls,
+                                           const uint8_t *_Nullable mask) {
+
+    ARMColumnSummary summary = { 0, 0, INFINITY, -INFINITY };
+#if ARM_COLUMN_SIMD
+    simd_double4 sum4 = 0, min4 = INFINITY, max4 = -INFINITY;
+#endif
+
+    for (NSUInteger block = 0; block * 8 < count; block++) {
+        NSUInteger location = block * 8;
+        uint8_t excluded = ARMColumnExcludedBits(nulls, mask, block);
+
+#if ARM_COLUMN_SIMD
+        if (excluded == 0 && location + 8 <= count) {
+            simd_double4 a = ARMColumnLoad4(values, int64, location);
+            simd_double4 b = ARMColumnLoad4(values, int64, location + 4);
+            sum4 += a + b;
+            min4 = simd_min(min4, simd_min(a, b));
+            max4 = simd_max(max4, simd_max(a, b));
+            summary.count += 8;
+            continue;
+        }
+#endif
+
+        for (NSUInteger i = location; i < MIN(location + 8, count); i++) {
+            if ((excluded >> (i - location)) & 1) {
+                continue;
+            }
+
+            double value = ARMColumnValue(values, int64, i);
+            summary.sum += value;
+            summary.min = MIN(summary.min, value);
+            summary.max = MAX(summary.max, value);
+            summary.count++;
+        }
+    }
+
+#if ARM_COLUMN_SIMD
+    summary.sum += simd_reduce_add(sum4);
+    summary.min = MIN(summary.min, simd_reduce_min(min4));
+    summary.max = MAX(summary.max, simd_reduce_max(max4));
+#endif
+
+    return summary;
+}
+
+/**
+ * Sums up the squared deviations from the mean.
+ */
+static double ARMColumnSumOfSquaredDeviations(const void *values,
+                                              bool int64,
+                                              NSUInteger count,
+                                              const uint8_t *nulls,
+                                              double mean) {
+
+    double sum = 0;
+#if ARM_COLUMN_SIMD
+    simd_double4 sum4 = 0;
+#endif
+
+    for (NSUInteger block = 0; block * 8 < count; block++) {
+        NSUInteger location = block * 8;
+        uint8_t excluded = nulls[block];
+
+#if ARM_COLUMN_SIMD
+        if (excluded == 0 && location + 8 <= count) {
+            simd_double4 a = ARMColumnLoad4(values, int64, location) - mean;
+            simd_double4 b = ARMColumnLoad4(values, int64, location + 4) - mean;
+            sum4 += a * a + b * b;
+            continue;
+        }
+#endif
+
+        for (NSUInteger i = location; i < MIN(location + 8, count); i++) {
+            if (!((excluded >> (i - location)) & 1)) {
+                double deviation = ARMColumnValue(values, int64, i) - mean;
+                sum += deviation * deviation;
+            }
+        }
+    }
+
+#if ARM_COLUMN_SIMD
+    sum += simd_reduce_add(sum4);
+#endif
+
+    return sum;
+}
+
+/**
+ * Counts the values in the buckets. The bucket indexes of a block without null values are calculated by SIMD
+ * instructions.
+ */
+static void ARMColumnFillHistogram(const void *values,
+                                   bool int64,
+                                   NSUInteger count,
+                                   const uint8_t *nulls,
+                                   double minimum,
+                                   double maximum,
+                                   NSUInteger *buckets,
+                                   NSUInteger bucketCount) {
+
+    double scale = bucketCount / (maximum - minimum);
+
+    for (NSUInteger block = 0; block * 8 < count; block++) {
+        NSUInteger location = block * 8;
+        uint8_t excluded = nulls[block];
+        double positions[8];
+
+#if ARM_COLUMN_SIMD
+        if (excluded == 0 && location + 8 <= count) {
+            *(simd_packed_double4 *) positions = (ARMColumnLoad4(values, int64, location) - minimum) * scale;
+            *(simd_packed_double4 *) (positions + 4) = (ARMColumnLoad4(values, int64, location + 4) - minimum) * scale;
+        }
+        else
+#endif
+        {
+            for (NSUInteger i = location; i < MIN(location + 8, count); i++) {
+                positions[i - location] = (ARMColumnValue(values, int64, i) - minimum) * scale;
+            }
+        }
+
+        for (NSUInteger i = location; i < MIN(location + 8, count); i++) {
+            double position = positions[i - location];
+
+            // The comparison is false for NAN.
+            if (!((excluded >> (i - location)) & 1) && position >= 0 && position <= bucketCount) {
+                buckets[MIN((NSUInteger) position, bucketCount - 1)]++;
+            }
+        }
+    }
+}
+
+static int ARMColumnCompareDoubles(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+@implementation ARMColumn (Statistics)
+
+- (double)sum {
+    return [self summaryWithMask:nil].sum;
+}
+
+- (double)sumWithMask:(NSData *)mask {
+    // A short mask would be read past its end. Assertions are compiled out in release builds.
+    if (mask.length < self.nullBitmap.length) {
+        [NSException raise:NSInvalidArgumentException format:@"The mask must be as long as the null bitmap."];
+    }
+
+    return [self summaryWithMask:mask].sum;
+}
+
+- (double)minimum {
+    ARMColumnSummary summary = [self summaryWithMask:nil];
+
+    return summary.count > 0 ? summary.min : NAN;
+}
+
+- (double)maximum {
+    ARMColumnSummary summary = [self summaryWithMask:nil];
+
+    return summary.count > 0 ? summary.max : NAN;
+}
+
+- (double)mean {
+    ARMColumnSummary summary = [self summaryWithMask:nil];
+
+    return summary.count > 0 ? summary.sum / summary.count : NAN;
+}
+
+- (double)variance {
+    ARMColumnSummary summary = [self summaryWithMask:nil];
+
+    if (summary.count == 0) {
+        return NAN;
+    }
+
+    // Two passes are more accurate than the sum of squares.
+    double sum = ARMColumnSumOfSquaredDeviations(self.values.bytes,
+                                                 self.type == ARMColumnTypeInt64,
+                                                 self.count,
+                                                 self.nullBitmap.bytes,
+                                                 summary.sum / summary.count);
+
+    return sum / summary.count;
+}
+
+- (NSArray<NSNumber *> *)percentiles:(NSArray<NSNumber *> *)fractions {
+    NSUInteger count = self.count - self.nullCount;
+    NSMutableArray<NSNumber *> *percentiles = [NSMutableArray new];
+
+    if (count == 0) {
+        for (NSUInteger i = 0; i < fractions.count; i++) {
+            [percentiles addObject:@(NAN)];
+        }
+
+        return percentiles;
+    }
+
+    NSMutableData *data = [NSMutableData dataWithLength:count * sizeof(double)];
+    double *sorted = data.mutableBytes;
+    bool int64 = self.type == ARMColumnTypeInt64;
+
+    for (NSUInteger i = 0, j = 0; i < self.count; i++) {
+        if (![self isNullAtIndex:i]) {
+            sorted[j++] = ARMColumnValue(self.values.bytes, int64, i);
+        }
+    }
+
+    qsort(sorted, count, sizeof(double), ARMColumnCompareDoubles);
+
+    for (NSNumber *fraction in fractions) {
+        double rank = MIN(MAX(fraction.doubleValue, 0), 1) * (count - 1);
+        NSUInteger lower = (NSUInteger) floor(rank);
+        NSUInteger upper = MIN(lower + 1, count - 1);
+
+        [percentiles addObject:@(sorted[lower] + (sorted[upper] - sorted[lower]) * (rank - lower))];
+    }
+
+    return percentiles;
+}
+
+- (NSArray<NSNumber *> *)histogramWithBucketCount:(NSUInteger)bucketCount
+                                          minimum:(double)minimum
+                                          maximum:(double)maximum {
+
+    // Values would be divided by a zero width or written out of the buckets otherwise.
+    if (bucketCount == 0) {
+        [NSException raise:NSInvalidArgumentException format:@"The bucket count must be greater than 0."];
+    }
+
+    if (!(minimum < maximum)) {
+        [NSException raise:NSInvalidArgumentException format:@"The minimum must be less than the maximum."];
+    }
+
+    NSMutableData *data = [NSMutableData dataWithLength:bucketCount * sizeof(NSUInteger)];
+    NSUInteger *buckets = data.mutableBytes;
+
+    ARMColumnFillHistogram(self.values.bytes,
+                           self.type == ARMColumnTypeInt64,
+                           self.count,
+                           self.nullBitmap.bytes,
+                           minimum,
+                           maximum,
+                           buckets,
+                           bucketCount);
+
+    NSMutableArray<NSNumber *> *histogram = [NSMutableArray arrayWithCapacity:bucketCount];
+
+    for (NSUInteger i = 0; i < bucketCount; i++) {
+        [histogram addObject:@(buckets[i])];
+    }
+
+    return histogram;
+}
+
+#pragma mark - private method
+
+- (ARMColumnSummary)summaryWithMask:(nullable NSData *)mask {
+    return ARMColumnSummarize(self.values.bytes,
+                              self.type == ARMColumnTypeInt64,
+                              self.count,
+                              self.nullBitmap.bytes,
+                              mask.bytes);
+}
+
+@end
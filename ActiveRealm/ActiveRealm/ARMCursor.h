@@ -28,31 +28,23 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-@class RLMRealm;
+@class RLMSortDescriptor;
 
-@interface ARMActiveRealmManager : NSObject
 /**
- * The default Realm object.
+ * A position in a sorted collection. It holds the values of the sort keys of a model instead of its index, so it
+ * stays valid when objects are inserted or deleted before it. Get a cursor by `-[ARMCollection cursorForObject:]`.
  */
-@property (nonatomic, readonly) RLMRealm *defaultRealm;
+@interface ARMCursor : NSObject
 /**
- * A vendor prefix.
- * e.g.) The ARMActiveRealmManager class has the vendor prefix: "ARM".
- *
- * Set this property if your ActiveRealm subclass has a vendor prefix and you want to get rid of
- * that vendor prefix from your ARMObject subclass.
+ * The sort descriptors of the collection the cursor was made from.
  */
-@property (nonatomic, copy, nullable) NSString *vendorPrefix;
-
+@property (nonatomic, copy, readonly) NSArray<RLMSortDescriptor *> *sortDescriptors;
 /**
- * Returns the singleton object of ARMActiveRealmManager.
- *
- * @return The singleton object.
+ * The values of the sort keys in the same order as `sortDescriptors`. NSNull represents nil.
  */
-+ (instancetype)sharedInstance NS_SWIFT_NAME(shared());
+@property (nonatomic, copy, readonly) NSArray *values;
 
-- (NSString *)stringFromClass:(Class)aClass namespace:(NSString *_Nullable *_Nullable)namespace;
-- (Class)map:(Class)aClass;
++ (instancetype)cursorWithSortDescriptors:(NSArray<RLMSortDescriptor *> *)sortDescriptors values:(NSArray *)values;
 
 @end
 
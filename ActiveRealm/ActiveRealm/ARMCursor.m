@@ -24,22 +24,34 @@
 // SOFTWARE.
 //
 
-#import <UIKit/UIKit.h>
+#import <Realm/Realm.h>
 
-//! Project version number for ActiveRealm.
-FOUNDATION_EXPORT double ActiveRealmVersionNumber;
+#import "ARMCursor.h"
 
-//! Project version string for ActiveRealm.
-FOUNDATION_EXPORT const unsigned char ActiveRealmVersionString[];
+@interface ARMCursor ()
 
-// In this header, you should import all the public headers of your framework using statements like #import <ActiveRealm/PublicHeader.h>
+@property (nonatomic, copy) NSArray<RLMSortDescriptor *> *sortDescriptors;
+@property (nonatomic, copy) NSArray *values;
 
-#import <Realm/Realm.h>
+@end
+
+@implementation ARMCursor
+
++ (instancetype)cursorWithSortDescriptors:(NSArray<RLMSortDescriptor *> *)sortDescriptors values:(NSArray *)values {
+    NSParameterAssert(sortDescriptors.count == values.count);
+
+    ARMCursor *cursor = [ARMCursor new];
+    cursor.sortDescriptors = sortDescriptors;
+    cursor.values = values;
+
+    return cursor;
+}
+
+- (NSString *)description {
+    return @{
+        @"keyPaths": [self.sortDescriptors valueForKey:@"keyPath"],
+        @"values": self.values
+    }.description;
+}
 
-#import "ARMActiveRealm.h"
-#import "ARMActiveRealmManager.h"
-#import "ARMCollection.h"
-#import "ARMObject.h"
-#import "ARMQuery.h"
-#import "ARMRelation.h"
-#import "ARMRelationship.h"
+@end
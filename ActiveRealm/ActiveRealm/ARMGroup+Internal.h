@@ -24,17 +24,25 @@
 // SOFTWARE.
 //
 
-#import <Foundation/Foundation.h>
-
-#import <Realm/Realm.h>
+#import "ARMGroup.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface ARMObject : RLMObject
+@class RLMResults;
+
+@interface ARMGroup (Internal)
 
-@property NSString *uid;
-@property NSDate *createdAt;
-@property NSDate *updatedAt;
+/**
+ * Groups the results by specified property in one pass.
+ *
+ * @param results The results.
+ * @param property The grouping property.
+ * @param aggregatedProperty The property to aggregate in each group, or nil.
+ * @return The groups sorted by key ascending. The group of nil comes first.
+ */
++ (NSArray<ARMGroup *> *)groupsFromResults:(RLMResults *)results
+                                byProperty:(NSString *)property
+                               aggregating:(nullable NSString *)aggregatedProperty;
 
 @end
 
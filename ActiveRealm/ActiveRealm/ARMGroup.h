@@ -28,31 +28,35 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-@class ARMActiveRealm;
-
-@interface ARMRelation : NSObject
 /**
- * Tells whether the relationship is One-to-One.
+ * The models that have the same value of a property. It holds only the number and the aggregated values, not models.
+ */
+@interface ARMGroup : NSObject
+/**
+ * The value of the grouping property. NSNull represents nil.
+ */
+@property (nonatomic, readonly) id key;
+/**
+ * The number of the models in the group.
  */
-@property (nonatomic, readonly) BOOL hasOne;
+@property (nonatomic, readonly) NSUInteger count;
 /**
- * Tells whether the relationship is One-to-Many.
+ * The sum of the aggregated property, or nil if no property is aggregated. The sum of an integer property is an
+ * integer, same as `-[ARMCollection sum:]`.
  */
-@property (nonatomic, readonly) BOOL hasMany;
+@property (nonatomic, nullable, readonly) NSNumber *sum;
 /**
- * Tells whether the relationship is inverse relationship for One-to-One or One-to-Many.
+ * The average of the aggregated property, or nil if no property is aggregated or all values are nil.
  */
-@property (nonatomic, readonly) BOOL belongsTo;
+@property (nonatomic, nullable, readonly) NSNumber *average;
 /**
- * If `hasOne` property is YES, returns a child object of the relationship.
- * On the other hand, if `belongsTo` property is YES, returns a parent object.
- * Otherwise, returns nil.
+ * The minimum value of the aggregated property, or nil if no property is aggregated or all values are nil.
  */
-@property (nonatomic, readonly, nullable) __kindof ARMActiveRealm *object;
+@property (nonatomic, nullable, readonly) id min;
 /**
- * If `hasMany` property is YES, returns children objects of the relationships, otherwise nil.
+ * The maximum value of the aggregated property, or nil if no property is aggregated or all values are nil.
  */
-@property (nonatomic, readonly, nullable) NSArray<__kindof ARMActiveRealm *> *objects;
+@property (nonatomic, nullable, readonly) id max;
 
 @end
 
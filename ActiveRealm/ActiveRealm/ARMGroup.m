@@ -0,0 +1,147 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Realm/Realm.h>
+
+#import "ARMGroup.h"
+#import "ARMGroup+Internal.h"
+
+@interface ARMGroup ()
+
+@property (nonatomic) id key;
+@property (nonatomic) NSUInteger count;
+@property (nonatomic) BOOL aggregated;
+// Integer properties are summed in int64_t, as Realm does, so that large sums do not lose precision.
+@property (nonatomic) BOOL integral;
+@property (nonatomic) int64_t integerTotal;
+@property (nonatomic) double total;
+@property (nonatomic) NSUInteger valueCount;
+@property (nonatomic, nullable) id min;
+@property (nonatomic, nullable) id max;
+
+@end
+
+@implementation ARMGroup
+
+#pragma mark - property
+
+- (nullable NSNumber *)sum {
+    if (!self.aggregated) {
+        return nil;
+    }
+
+    return self.integral ? @(self.integerTotal) : @(self.total);
+}
+
+- (nullable NSNumber *)average {
+    if (self.valueCount == 0) {
+        return nil;
+    }
+
+    return @((self.integral ? (double) self.integerTotal : self.total) / self.valueCount);
+}
+
+#pragma mark - public method
+
+- (NSString *)description {
+    return [self dictionaryWithValuesForKeys:@[
+        @"key",
+        @"count",
+        @"sum",
+        @"average",
+        @"min",
+        @"max"
+    ]].description;
+}
+
+#pragma mark - private method
+
+- (void)addValue:(nullable id)value {
+    if (!value || value == [NSNull null]) {
+        return;
+    }
+
+    if (self.integral) {
+        self.integerTotal += ((NSNumber *) value).longLongValue;
+    }
+    else if ([value isKindOfClass:[NSNumber class]]) {
+        self.total += ((NSNumber *) value).doubleValue;
+    }
+
+    if (!self.min || [value compare:self.min] == NSOrderedAscending) {
+        self.min = value;
+    }
+
+    if (!self.max || [value compare:self.max] == NSOrderedDescending) {
+        self.max = value;
+    }
+
+    self.valueCount++;
+}
+
+@end
+
+@implementation ARMGroup (Internal)
+
++ (NSArray<ARMGroup *> *)groupsFromResults:(RLMResults *)results
+                                byProperty:(NSString *)property
+                               aggregating:(nullable NSString *)aggregatedProperty {
+
+    NSMutableDictionary<id, ARMGroup *> *groups = [NSMutableDictionary new];
+    RLMObjectSchema *objectSchema = results.realm.schema[results.objectClassName];
+    RLMProperty *aggregated = aggregatedProperty ? objectSchema[aggregatedProperty] : nil;
+    BOOL integral = aggregated && aggregated.type == RLMPropertyTypeInt;
+
+    for (RLMObject *obj in results) {
+        id key = obj[property] ?: [NSNull null];
+        ARMGroup *group = groups[key];
+
+        if (!group) {
+            group = [ARMGroup new];
+            group.key = key;
+            group.aggregated = aggregatedProperty != nil;
+            group.integral = integral;
+            groups[key] = group;
+        }
+
+        group.count++;
+
+        if (aggregatedProperty) {
+            [group addValue:obj[aggregatedProperty]];
+        }
+    }
+
+    return [groups.allValues sortedArrayUsingComparator:^NSComparisonResult(ARMGroup *group1, ARMGroup *group2) {
+        if (group1.key == [NSNull null] || group2.key == [NSNull null]) {
+            return group1.key == group2.key ? NSOrderedSame :
+                   (group1.key == [NSNull null] ? NSOrderedAscending : NSOrderedDescending);
+        }
+
+        return [group1.key compare:group2.key];
+    }];
+}
+
+@end
@@ -29,30 +29,31 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ARMActiveRealm;
+@class RLMResults;
 
-@interface ARMRelation : NSObject
 /**
- * Tells whether the relationship is One-to-One.
+ * An immutable array of models backed by RLMResults. The count is taken from the results and a model is hydrated when
+ * it is accessed. Only the models in a small window around the last accessed index are kept. A model released by all
+ * callers after the window moves is hydrated again on next access, so it is another instance with the stored values.
+ *
+ * The array holds the results for its lifetime. If they are frozen, the Realm version they belong to is kept until the
+ * array is released, so do not keep the array longer than needed.
  */
-@property (nonatomic, readonly) BOOL hasOne;
-/**
- * Tells whether the relationship is One-to-Many.
- */
-@property (nonatomic, readonly) BOOL hasMany;
-/**
- * Tells whether the relationship is inverse relationship for One-to-One or One-to-Many.
- */
-@property (nonatomic, readonly) BOOL belongsTo;
-/**
- * If `hasOne` property is YES, returns a child object of the relationship.
- * On the other hand, if `belongsTo` property is YES, returns a parent object.
- * Otherwise, returns nil.
- */
-@property (nonatomic, readonly, nullable) __kindof ARMActiveRealm *object;
+@interface ARMLazyArray<__covariant ObjectType> : NSArray<ObjectType>
+
 /**
- * If `hasMany` property is YES, returns children objects of the relationships, otherwise nil.
+ * Initializes the array.
+ *
+ * @param aClass The model class.
+ * @param results The results. The results should not change while the array is in use.
+ * @return The array.
  */
-@property (nonatomic, readonly, nullable) NSArray<__kindof ARMActiveRealm *> *objects;
+- (instancetype)initWithClass:(Class)aClass results:(RLMResults *)results NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithCoder:(NSCoder *)coder NS_UNAVAILABLE;
+- (instancetype)initWithObjects:(const ObjectType _Nonnull [_Nullable])objects
+                          count:(NSUInteger)cnt NS_UNAVAILABLE;
 
 @end
 
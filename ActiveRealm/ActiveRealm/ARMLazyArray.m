@@ -0,0 +1,117 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <os/lock.h>
+
+#import <Realm/Realm.h>
+
+#import "ARMLazyArray.h"
+
+#import "ARMActiveRealm.h"
+#import "ARMActiveRealm+Internal.h"
+
+/**
+ * The number of models hydrated at once.
+ */
+static const NSUInteger kLazyArrayWindowSize = 32;
+
+@implementation ARMLazyArray {
+    Class _modelClass;
+    RLMResults *_results;
+    NSUInteger _count;
+    os_unfair_lock _lock;
+    NSArray<ARMActiveRealm *> *_window;
+    NSUInteger _windowLocation;
+    // The models hydrated so far keyed by index. A model still held by a caller is returned again, not rebuilt.
+    NSMapTable<NSNumber *, ARMActiveRealm *> *_models;
+}
+
+- (instancetype)initWithClass:(Class)aClass results:(RLMResults *)results {
+    self = [super init];
+
+    if (self) {
+        _modelClass = aClass;
+        _results = results;
+        _count = results.count;
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _models = [NSMapTable strongToWeakObjectsMapTable];
+    }
+
+    return self;
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _count) {
+        [NSException raise:NSRangeException
+                    format:@"*** -[%@ objectAtIndex:]: index %lu beyond bounds [0 .. %ld]",
+                           NSStringFromClass(self.class), (unsigned long) index, (long) _count - 1];
+    }
+
+    os_unfair_lock_lock(&_lock);
+
+    if (!_window || index < _windowLocation || index >= _windowLocation + _window.count) {
+        _windowLocation = index - index % kLazyArrayWindowSize;
+        _window = [self modelsInRange:NSMakeRange(_windowLocation,
+                                                  MIN(kLazyArrayWindowSize, _count - _windowLocation))];
+    }
+
+    ARMActiveRealm *activeRealm = _window[index - _windowLocation];
+
+    os_unfair_lock_unlock(&_lock);
+
+    return activeRealm;
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+    return self;
+}
+
+#pragma mark - private method
+
+- (NSArray<ARMActiveRealm *> *)modelsInRange:(NSRange)range {
+    NSMutableArray<ARMActiveRealm *> *models = [NSMutableArray arrayWithCapacity:range.length];
+
+    for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+        ARMActiveRealm *activeRealm = [_models objectForKey:@(i)];
+
+        if (!activeRealm) {
+            activeRealm = [_modelClass activeRealmWithRLMObject:_results[i]];
+            [_models setObject:activeRealm forKey:@(i)];
+        }
+
+        [models addObject:activeRealm];
+    }
+
+    return models;
+}
+
+@end
@@ -0,0 +1,118 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ARMRelationship;
+
+/**
+ * The getter and the setter of a property resolved once per class.
+ */
+typedef struct {
+    SEL getter;
+    SEL setter;
+    IMP getterIMP;
+    IMP setterIMP;
+} ARMPropertyAccessor;
+
+NS_INLINE id _Nullable ARMPropertyAccessorGetValue(const ARMPropertyAccessor *accessor, id obj) {
+    return ((id (*)(id, SEL)) accessor->getterIMP)(obj, accessor->getter);
+}
+
+NS_INLINE void ARMPropertyAccessorSetValue(const ARMPropertyAccessor *accessor, id obj, id _Nullable value) {
+    ((void (*)(id, SEL, id)) accessor->setterIMP)(obj, accessor->setter, value);
+}
+
+/**
+ * The compiled schema of an ActiveRealm subclass. It is built once per class by reflecting the class and is immutable
+ * after that, so it can be shared between threads.
+ */
+@interface ARMModelSchema : NSObject
+/**
+ * The ActiveRealm subclass.
+ */
+@property (nonatomic, readonly) Class modelClass;
+/**
+ * The ARMObject subclass mapped to the model class.
+ */
+@property (nonatomic, readonly) Class realmClass;
+/**
+ * The persisted property names in declaration order. Superclass properties come first.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *propertyNames;
+/**
+ * The types of all properties of the model keyed by property name.
+ */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSString *> *propertyTypes;
+/**
+ * The property names the model does not persist.
+ */
+@property (nonatomic, copy, readonly) NSSet<NSString *> *ignoredProperties;
+/**
+ * The relationships the model defines.
+ */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, ARMRelationship *> *relationships;
+/**
+ * The foreign key names of the relationships keyed by the same key as `relationships`.
+ */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSString *> *foreignKeyNames;
+/**
+ * The persisted property names indexed in the DB in the same order as `propertyNames`. They are the foreign keys the
+ * model holds and the properties the model declares by `+indexedProperties`.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *indexedPropertyNames;
+/**
+ * The accessors indexed by property slot. The first `propertyNames.count` slots are the persisted properties in the
+ * same order as `propertyNames`, the ignored properties follow them. The buffer is owned by the schema.
+ */
+@property (nonatomic, readonly) const ARMPropertyAccessor *accessors NS_RETURNS_INNER_POINTER;
+
+/**
+ * Returns the schema of specified class. The schema is built on first use and cached.
+ *
+ * @param aClass An ActiveRealm subclass.
+ * @return The schema.
+ */
++ (instancetype)schemaForClass:(Class)aClass;
+/**
+ * Discards all cached schemas. They are rebuilt on next use.
+ */
++ (void)removeAllSchemas;
+/**
+ * Returns the slot of specified property in `accessors`.
+ *
+ * @param prop A property name.
+ * @return The slot, or NSNotFound if the model does not have the property.
+ */
+- (NSUInteger)slotForProperty:(NSString *)prop;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,257 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <os/lock.h>
+
+#import "ARMModelSchema.h"
+
+#import "ARMActiveRealm.h"
+#import "ARMActiveRealmManager.h"
+#import "ARMProperty.h"
+#import "ARMRelationship.h"
+
+@interface ARMModelSchema ()
+
+@property (nonatomic) Class modelClass;
+@property (nonatomic) Class realmClass;
+@property (nonatomic, copy) NSArray<NSString *> *propertyNames;
+@property (nonatomic, copy) NSDictionary<NSString *, NSString *> *propertyTypes;
+@property (nonatomic, copy) NSSet<NSString *> *ignoredProperties;
+@property (nonatomic, copy) NSDictionary<NSString *, ARMRelationship *> *relationships;
+@property (nonatomic, copy) NSDictionary<NSString *, NSString *> *foreignKeyNames;
+@property (nonatomic, copy) NSArray<NSString *> *indexedPropertyNames;
+@property (nonatomic, copy) NSDictionary<NSString *, NSNumber *> *slots;
+
+@end
+
+@implementation ARMModelSchema {
+    ARMPropertyAccessor *_accessors;
+}
+
+static os_unfair_lock ARMModelSchemaLock = OS_UNFAIR_LOCK_INIT;
+static NSMapTable<Class, ARMModelSchema *> *ARMModelSchemas = nil;
+
++ (instancetype)schemaForClass:(Class)aClass {
+    os_unfair_lock_lock(&ARMModelSchemaLock);
+    ARMModelSchema *schema = [ARMModelSchemas objectForKey:aClass];
+    os_unfair_lock_unlock(&ARMModelSchemaLock);
+
+    if (schema) {
+        return schema;
+    }
+
+    // Build the schema outside the lock because it calls methods overridden by the model.
+    ARMModelSchema *newSchema = [[ARMModelSchema alloc] initWithClass:aClass];
+
+    os_unfair_lock_lock(&ARMModelSchemaLock);
+
+    if (!ARMModelSchemas) {
+        ARMModelSchemas = [NSMapTable strongToStrongObjectsMapTable];
+    }
+
+    // Another thread may have built the schema in the meantime. Keep the first one.
+    schema = [ARMModelSchemas objectForKey:aClass];
+
+    if (!schema) {
+        [ARMModelSchemas setObject:newSchema forKey:aClass];
+        schema = newSchema;
+    }
+
+    os_unfair_lock_unlock(&ARMModelSchemaLock);
+
+    return schema;
+}
+
++ (void)removeAllSchemas {
+    os_unfair_lock_lock(&ARMModelSchemaLock);
+    [ARMModelSchemas removeAllObjects];
+    os_unfair_lock_unlock(&ARMModelSchemaLock);
+}
+
+- (instancetype)initWithClass:(Class)aClass {
+    self = [super init];
+
+    if (self) {
+        _modelClass = aClass;
+        _realmClass = [[ARMActiveRealmManager sharedInstance] map:aClass];
+        _ignoredProperties = [NSSet setWithArray:[aClass ignoredProperties]];
+        _relationships = [[aClass definedRelationships] copy];
+        _foreignKeyNames = [self foreignKeyNamesOfRelationships];
+
+        // Collect properties from the root model class down to specified class.
+        NSMutableArray<Class> *classes = [NSMutableArray new];
+
+        for (Class cls = aClass; cls && cls != NSObject.class; cls = class_getSuperclass(cls)) {
+            [classes insertObject:cls atIndex:0];
+        }
+
+        NSMutableArray<NSString *> *names = [NSMutableArray new];
+        NSMutableDictionary<NSString *, NSString *> *types = [NSMutableDictionary new];
+
+        for (Class cls in classes) {
+            NSDictionary<NSString *, NSString *> *props = ARMGetProperties(cls);
+
+            for (NSString *prop in ARMGetPropertyNames(cls)) {
+                if (!types[prop] && [self isPersistedProperty:prop]) {
+                    [names addObject:prop];
+                }
+
+                types[prop] = props[prop];
+            }
+        }
+
+        _propertyNames = names;
+        _propertyTypes = types;
+        _indexedPropertyNames = [self indexedPropertyNamesOfClass:aClass];
+
+        [self buildAccessors];
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_accessors);
+}
+
+- (NSString *)description {
+    return [self dictionaryWithValuesForKeys:@[
+        @"modelClass",
+        @"realmClass",
+        @"propertyNames",
+        @"ignoredProperties",
+        @"relationships"
+    ]].description;
+}
+
+#pragma mark - property
+
+- (const ARMPropertyAccessor *)accessors {
+    return _accessors;
+}
+
+#pragma mark - public method
+
+- (NSUInteger)slotForProperty:(NSString *)prop {
+    NSNumber *slot = self.slots[prop];
+
+    return slot ? slot.unsignedIntegerValue : NSNotFound;
+}
+
+#pragma mark - private method
+
+- (void)buildAccessors {
+    NSMutableArray<NSString *> *names = self.propertyNames.mutableCopy;
+
+    for (NSString *prop in self.ignoredProperties) {
+        if (self.propertyTypes[prop]) {
+            [names addObject:prop];
+        }
+    }
+
+    NSMutableDictionary<NSString *, NSNumber *> *slots = [NSMutableDictionary new];
+    _accessors = calloc(MAX(names.count, 1), sizeof(ARMPropertyAccessor));
+
+    for (NSUInteger i = 0; i < names.count; i++) {
+        NSString *prop = names[i];
+        objc_property_t property = class_getProperty(self.modelClass, prop.UTF8String);
+
+        // Respect custom accessor names declared by `getter=` and `setter=` attributes.
+        char *getterName = property ? property_copyAttributeValue(property, "G") : NULL;
+        char *setterName = property ? property_copyAttributeValue(property, "S") : NULL;
+
+        NSString *defaultSetterName = [NSString stringWithFormat:@"set%@%@:",
+                                                                 [prop substringToIndex:1].uppercaseString,
+                                                                 [prop substringFromIndex:1]];
+        SEL getter = getterName ? sel_registerName(getterName) : NSSelectorFromString(prop);
+        SEL setter = setterName ? sel_registerName(setterName) : NSSelectorFromString(defaultSetterName);
+
+        free(getterName);
+        free(setterName);
+
+        _accessors[i].getter = getter;
+        _accessors[i].setter = setter;
+        // The IMP of a missing method is the forwarding one, so a missing setter raises as sending the message does.
+        _accessors[i].getterIMP = class_getMethodImplementation(self.modelClass, getter);
+        _accessors[i].setterIMP = class_getMethodImplementation(self.modelClass, setter);
+
+        slots[prop] = @(i);
+    }
+
+    self.slots = slots;
+}
+
+- (NSDictionary<NSString *, NSString *> *)foreignKeyNamesOfRelationships {
+    NSDictionary<NSString *, ARMRelationship *> *relationships = self.relationships;
+    ARMActiveRealmManager *manager = [ARMActiveRealmManager sharedInstance];
+    NSMutableDictionary<NSString *, NSString *> *foreignKeyNames = [NSMutableDictionary new];
+
+    for (NSString *prop in relationships) {
+        ARMRelationship *relationship = relationships[prop];
+
+        // The foreign key is held by the child and named after the parent class.
+        NSString *className = relationship.type == ARMInverseRelationshipTypeBelongsTo ?
+            [manager stringFromClass:relationship.relationClass namespace:nil] :
+            [manager stringFromClass:self.modelClass namespace:nil];
+        foreignKeyNames[prop] = [NSString stringWithFormat:@"%@%@ID",
+                                                           [className substringToIndex:1].lowercaseString,
+                                                           [className substringFromIndex:1]];
+    }
+
+    return foreignKeyNames;
+}
+
+- (NSArray<NSString *> *)indexedPropertyNamesOfClass:(Class)aClass {
+    NSMutableSet<NSString *> *indexed = [NSMutableSet setWithArray:[aClass indexedProperties]];
+
+    // Only a belongsTo relationship has its foreign key in this model.
+    for (NSString *prop in self.relationships) {
+        if (self.relationships[prop].type == ARMInverseRelationshipTypeBelongsTo) {
+            [indexed addObject:self.foreignKeyNames[prop]];
+        }
+    }
+
+    NSMutableArray<NSString *> *names = [NSMutableArray new];
+
+    for (NSString *prop in self.propertyNames) {
+        if ([indexed containsObject:prop]) {
+            [names addObject:prop];
+        }
+    }
+
+    return names;
+}
+
+- (BOOL)isPersistedProperty:(NSString *)prop {
+    return ![self.ignoredProperties containsObject:prop] &&
+           !self.relationships[prop] &&
+           ![prop isEqualToString:@"relations"] &&
+           ![prop isEqualToString:@"description"] &&
+           ![prop isEqualToString:@"debugDescription"] &&
+           ![prop isEqualToString:@"hash"];
+}
+
+@end
@@ -24,12 +24,58 @@
 // SOFTWARE.
 //
 
+#import <objc/runtime.h>
+
 #import "ARMObject.h"
 
+#import "ARMActiveRealm.h"
+#import "ARMActiveRealmManager.h"
+#import "ARMModelSchema.h"
+
 @implementation ARMObject
 
 + (NSString *)primaryKey {
     return @"uid";
 }
 
++ (NSArray<NSString *> *)indexedProperties {
+    Class modelClass = [self modelClass];
+
+    if (!modelClass) {
+        return [super indexedProperties];
+    }
+
+    NSMutableOrderedSet<NSString *> *indexed = [NSMutableOrderedSet orderedSetWithArray:[super indexedProperties]];
+
+    // Realm raises on an indexed property it doesn't know, so skip the ones this class doesn't declare.
+    for (NSString *prop in [ARMModelSchema schemaForClass:modelClass].indexedPropertyNames) {
+        if (class_getProperty(self, prop.UTF8String)) {
+            [indexed addObject:prop];
+        }
+    }
+
+    return indexed.array;
+}
+
+#pragma mark - private method
+
++ (nullable Class)modelClass {
+    static NSString *const prefix = @"ActiveRealm";
+
+    // Reverse the mapping from the model class. e.g.) MyApp.ActiveRealmArticle -> MyApp.ARMArticle
+    NSMutableArray<NSString *> *nameComponents = [NSStringFromClass(self) componentsSeparatedByString:@"."].mutableCopy;
+    NSString *className = nameComponents.lastObject;
+
+    if (![className hasPrefix:prefix] || className.length == prefix.length) {
+        return nil;
+    }
+
+    NSString *vendorPrefix = [ARMActiveRealmManager sharedInstance].vendorPrefix ?: @"";
+    nameComponents[nameComponents.count - 1] = [vendorPrefix stringByAppendingString:
+                                                                 [className substringFromIndex:prefix.length]];
+    Class modelClass = NSClassFromString([nameComponents componentsJoinedByString:@"."]);
+
+    return [modelClass isSubclassOfClass:ARMActiveRealm.class] ? modelClass : nil;
+}
+
 @end
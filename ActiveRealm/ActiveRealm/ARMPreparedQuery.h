@@ -0,0 +1,76 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ARMActiveRealm;
+@class RLMSortDescriptor;
+
+/**
+ * A query prepared once and executed many times with different values. The predicate template, the Realm class and
+ * the sort descriptors are resolved when it is created, so an execution costs only substituting the variables and
+ * the query of Realm.
+ */
+@interface ARMPreparedQuery : NSObject
+/**
+ * The predicate template that contains `$variables`.
+ */
+@property (nonatomic, readonly) NSPredicate *predicateTemplate;
+/**
+ * Maximum number of acquisitions. 0 means no limit.
+ */
+@property (nonatomic, readonly) NSUInteger limit;
+
+/**
+ * Prepares a query.
+ *
+ * @param aClass The model class.
+ * @param predicateTemplate A predicate template that contains `$variables`, such as `authorID == $authorID`.
+ * @param sortDescriptors Sort descriptors. The first descriptor takes precedence. Ties are broken by `createdAt`
+ *                        ascending and then `uid` ascending, same as ARMCollection.
+ * @param limit Maximum number of acquisitions. 0 means no limit.
+ * @return The prepared query.
+ */
+- (instancetype)initWithClass:(Class)aClass
+            predicateTemplate:(NSPredicate *)predicateTemplate
+              sortDescriptors:(nullable NSArray<RLMSortDescriptor *> *)sortDescriptors
+                        limit:(NSUInteger)limit;
+/**
+ * Executes the query.
+ *
+ * @param bindings The values of the variables keyed by variable name without `$`.
+ * @return Objects of the model.
+ */
+- (NSArray<__kindof ARMActiveRealm *> *)executeWithBindings:(NSDictionary<NSString *, id> *)bindings
+    NS_SWIFT_NAME(execute(bindings:));
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,95 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Realm/Realm.h>
+
+#import "ARMPreparedQuery.h"
+
+#import "ARMActiveRealm.h"
+#import "ARMActiveRealm+Internal.h"
+#import "ARMActiveRealmManager.h"
+#import "ARMCollection.h"
+#import "ARMCollection+Internal.h"
+#import "ARMModelSchema.h"
+
+@interface ARMPreparedQuery ()
+
+@property (nonatomic) Class modelClass;
+@property (nonatomic) Class realmClass;
+@property (nonatomic) NSPredicate *predicateTemplate;
+@property (nonatomic, copy) NSArray<RLMSortDescriptor *> *sortDescriptors;
+@property (nonatomic) NSUInteger limit;
+
+@end
+
+@implementation ARMPreparedQuery
+
+- (instancetype)initWithClass:(Class)aClass
+            predicateTemplate:(NSPredicate *)predicateTemplate
+              sortDescriptors:(nullable NSArray<RLMSortDescriptor *> *)sortDescriptors
+                        limit:(NSUInteger)limit {
+
+    self = [super init];
+
+    if (self) {
+        _modelClass = aClass;
+        _realmClass = [ARMModelSchema schemaForClass:aClass].realmClass;
+        _predicateTemplate = predicateTemplate;
+        // Same tie-breakers as ARMCollection, so that both return models with equal sort keys in the same order.
+        _sortDescriptors = [ARMCollection resolvedSortDescriptors:sortDescriptors ?: @[]];
+        _limit = limit;
+    }
+
+    return self;
+}
+
+#pragma mark - public method
+
+- (NSArray<__kindof ARMActiveRealm *> *)executeWithBindings:(NSDictionary<NSString *, id> *)bindings {
+    NSPredicate *predicate = [self.predicateTemplate predicateWithSubstitutionVariables:bindings];
+    RLMResults *results = [self.realmClass objectsInRealm:ARMActiveRealmManager.sharedInstance.defaultRealm
+                                            withPredicate:predicate];
+    results = [results sortedResultsUsingDescriptors:self.sortDescriptors];
+    NSUInteger count = self.limit > 0 ? MIN(self.limit, results.count) : results.count;
+    NSMutableArray<ARMActiveRealm *> *array = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [array addObject:[self.modelClass activeRealmWithRLMObject:results[i]]];
+    }
+
+    return array;
+}
+
+- (NSString *)description {
+    return [self dictionaryWithValuesForKeys:@[
+        @"modelClass",
+        @"predicateTemplate",
+        @"sortDescriptors",
+        @"limit"
+    ]].description;
+}
+
+@end
@@ -31,6 +31,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 FOUNDATION_EXTERN const char *ARMGetPropertyType(objc_property_t property, BOOL *isPrimitiveType);
 FOUNDATION_EXTERN NSDictionary<NSString *, NSString *> *ARMGetProperties(Class aClass);
+FOUNDATION_EXTERN NSArray<NSString *> *ARMGetPropertyNames(Class aClass);
 
 @interface ARMProperty : NSObject
 
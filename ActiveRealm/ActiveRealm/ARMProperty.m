@@ -87,6 +87,25 @@ NSDictionary<NSString *, NSString *> *ARMGetProperties(Class aClass) {
     return props;
 }
 
+NSArray<NSString *> *ARMGetPropertyNames(Class aClass) {
+    NSMutableArray<NSString *> *names = [NSMutableArray new];
+
+    unsigned int outCount;
+    objc_property_t *properties = class_copyPropertyList(aClass, &outCount);
+
+    for (int i = 0; i < outCount; i++) {
+        const char *propName = property_getName(properties[i]);
+
+        if (propName) {
+            [names addObject:[NSString stringWithUTF8String:propName]];
+        }
+    }
+
+    free(properties);
+
+    return names;
+}
+
 @implementation ARMProperty
 
 @end
@@ -29,19 +29,24 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ARMCollection;
+@class ARMQueryBuilder;
 
 @interface ARMQuery : NSObject
 /**
  * Returns all objects of the model.
  */
 @property (nonatomic, readonly) ARMCollection *all;
+/**
+ * Returns a new query builder of the model.
+ */
+@property (nonatomic, readonly) ARMQueryBuilder *builder;
 
 - (instancetype)initWithClass:(Class)aClass;
 
 /**
  * Returns objects searched by specified parameters.
  *
- * @param dictionary Parameters for searching.
+ * @param dictionary Parameters for searching. NSInvalidArgumentException is raised if it is empty.
  * @return Objects of the model.
  */
 - (ARMCollection *)where:(NSDictionary<NSString *, id> *)dictionary;
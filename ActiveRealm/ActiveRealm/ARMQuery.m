@@ -24,12 +24,15 @@
 // SOFTWARE.
 //
 
+#import <os/lock.h>
+
 #import <Realm/Realm.h>
 
 #import "ARMQuery.h"
 
 #import "ARMActiveRealmManager.h"
 #import "ARMCollection.h"
+#import "ARMQueryBuilder.h"
 
 @interface ARMQuery ()
 
@@ -61,6 +64,10 @@
     return [[ARMCollection alloc] initWithClass:self.modelClass results:results];
 }
 
+- (ARMQueryBuilder *)builder {
+    return [[ARMQueryBuilder alloc] initWithClass:self.modelClass];
+}
+
 - (ARMCollection *)where:(NSDictionary<NSString *, id> *)dictionary {
     return [self whereWithPredicate:[ARMQuery predicateWithDictionary:dictionary]];
 }
@@ -86,17 +93,57 @@
 #pragma mark - private method
 
 + (NSPredicate *)predicateWithDictionary:(NSDictionary<NSString *, id> *)dictionary {
-    NSMutableArray *formats = [NSMutableArray new];
-    NSMutableArray *arguments = [NSMutableArray new];
+    // An empty template would match every object, so `destroy:@{}` would delete all of them.
+    if (dictionary.count == 0) {
+        [NSException raise:NSInvalidArgumentException format:@"The dictionary of a query must not be empty."];
+    }
+
+    NSArray<NSString *> *keys = [dictionary.allKeys sortedArrayUsingSelector:@selector(compare:)];
 
-    for (NSString *prop in dictionary.allKeys) {
-        [formats addObject:[prop stringByAppendingString:@"=%@"]];
-        [arguments addObject:dictionary[prop]];
+    // The variables are named after the keys, so the dictionary is the substitution variables as it is.
+    return [[self predicateTemplateWithKeys:keys] predicateWithSubstitutionVariables:dictionary];
+}
+
+/**
+ * Returns the template of `key1 == $key1 AND key2 == $key2 ...` for specified keys. The template is built once per key
+ * set and cached, so a query only substitutes the variables.
+ *
+ * @param keys Sorted keys.
+ * @return The predicate template.
+ */
++ (NSPredicate *)predicateTemplateWithKeys:(NSArray<NSString *> *)keys {
+    static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    static NSMutableDictionary<NSArray<NSString *> *, NSPredicate *> *templates;
+
+    os_unfair_lock_lock(&lock);
+    NSPredicate *template = templates[keys];
+    os_unfair_lock_unlock(&lock);
+
+    if (template) {
+        return template;
     }
 
-    NSString *format = [formats componentsJoinedByString:@" AND "];
+    NSMutableArray<NSPredicate *> *predicates = [NSMutableArray arrayWithCapacity:keys.count];
+
+    for (NSString *key in keys) {
+        NSExpression *left = [NSExpression expressionForKeyPath:key];
+        NSExpression *right = [NSExpression expressionForVariable:key];
+        [predicates addObject:[NSComparisonPredicate predicateWithLeftExpression:left
+                                                                 rightExpression:right
+                                                                        modifier:NSDirectPredicateModifier
+                                                                            type:NSEqualToPredicateOperatorType
+                                                                         options:0]];
+    }
+
+    template = predicates.count == 1 ? predicates.firstObject :
+               [NSCompoundPredicate andPredicateWithSubpredicates:predicates];
+
+    os_unfair_lock_lock(&lock);
+    templates = templates ?: [NSMutableDictionary new];
+    templates[keys] = template;
+    os_unfair_lock_unlock(&lock);
 
-    return [NSPredicate predicateWithFormat:format argumentArray:arguments];
+    return template;
 }
 
 @end
@@ -0,0 +1,140 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ARMActiveRealm;
+@class ARMCollection;
+
+/**
+ * A builder that collects query clauses and compiles them into one predicate, one sort and one page when the query is
+ * executed. The clauses are combined with AND. The property names are checked against the model when a clause is
+ * added, and an NSInvalidArgumentException is raised for unknown properties.
+ */
+@interface ARMQueryBuilder : NSObject
+/**
+ * The compiled predicate of the clauses.
+ */
+@property (nonatomic, readonly) NSPredicate *predicate;
+/**
+ * The collection searched by the clauses and sorted by the orders. The limit and the offset are not applied.
+ */
+@property (nonatomic, readonly) ARMCollection *collection;
+/**
+ * The models searched by the clauses in the page of the limit and the offset.
+ */
+@property (nonatomic, readonly) NSArray<__kindof ARMActiveRealm *> *toArray;
+/**
+ * The first model in the page.
+ */
+@property (nonatomic, nullable, readonly) __kindof ARMActiveRealm *first;
+/**
+ * The number of models in the page.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+- (instancetype)initWithClass:(Class)aClass;
+
+/**
+ * Adds the condition that the properties are equal to specified values.
+ *
+ * @param dictionary Values keyed by property name.
+ * @return The builder.
+ */
+- (instancetype)where:(NSDictionary<NSString *, id> *)dictionary;
+/**
+ * Adds the condition that the properties are not all equal to specified values.
+ * With several keys, a model is excluded only when it matches every pair.
+ *
+ * @param dictionary Values keyed by property name.
+ * @return The builder.
+ */
+- (instancetype)whereNot:(NSDictionary<NSString *, id> *)dictionary;
+/**
+ * Adds the condition that the property is one of specified values.
+ *
+ * @param property A property.
+ * @param values Values.
+ * @return The builder.
+ */
+- (instancetype)in:(NSString *)property values:(NSArray *)values NS_SWIFT_NAME(in(_:values:));
+/**
+ * Adds the condition that the property is between specified values inclusive.
+ *
+ * @param property A property.
+ * @param lower The lower bound.
+ * @param upper The upper bound.
+ * @return The builder.
+ */
+- (instancetype)between:(NSString *)property
+                  lower:(id)lower
+                  upper:(id)upper NS_SWIFT_NAME(between(_:lower:upper:));
+/**
+ * Adds the condition that the property matches specified pattern. `?` matches a character and `*` matches zero or
+ * more characters.
+ *
+ * @param property A property.
+ * @param pattern A pattern.
+ * @return The builder.
+ */
+- (instancetype)like:(NSString *)property pattern:(NSString *)pattern NS_SWIFT_NAME(like(_:pattern:));
+/**
+ * Combines the clauses added so far and the clauses of specified builder with OR.
+ * A side without clauses is left out, so that it does not make the query match every model.
+ * It is not named `or:` because `or` is an operator in Objective-C++.
+ *
+ * @param builder A builder of the same model.
+ * @return The builder.
+ */
+- (instancetype)orWhere:(ARMQueryBuilder *)builder NS_SWIFT_NAME(or(_:));
+/**
+ * Sorts the models by specified property. The first order takes precedence.
+ *
+ * @param property A property.
+ * @param ascending YES if ascending, otherwise descending.
+ * @return The builder.
+ */
+- (instancetype)order:(NSString *)property ascending:(BOOL)ascending;
+/**
+ * Limits the number of the models.
+ *
+ * @param limit Maximum number of acquisitions. 0 means no limit.
+ * @return The builder.
+ */
+- (instancetype)limit:(NSUInteger)limit;
+/**
+ * Skips specified number of the models from the head.
+ *
+ * @param offset The number of models to skip.
+ * @return The builder.
+ */
+- (instancetype)offset:(NSUInteger)offset;
+
+@end
+
+NS_ASSUME_NONNULL_END
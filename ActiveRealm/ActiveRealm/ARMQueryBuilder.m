@@ -0,0 +1,227 @@
+//
+// ActiveRealm
+//
+// MIT License
+//
+// Copyright (c) 2019-present Hituzi Ando
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#import <Realm/Realm.h>
+
+#import "ARMQueryBuilder.h"
+
+#import "ARMCollection.h"
+#import "ARMModelSchema.h"
+#import "ARMQuery.h"
+
+@interface ARMQueryBuilder ()
+
+@property (nonatomic) Class modelClass;
+@property (nonatomic) ARMModelSchema *schema;
+@property (nonatomic) NSMutableArray<NSPredicate *> *clauses;
+@property (nonatomic) NSMutableArray<RLMSortDescriptor *> *sortDescriptors;
+
+@end
+
+@implementation ARMQueryBuilder {
+    NSUInteger _limit;
+    NSUInteger _offset;
+}
+
+- (instancetype)initWithClass:(Class)aClass {
+    self = [super init];
+
+    if (self) {
+        _modelClass = aClass;
+        _schema = [ARMModelSchema schemaForClass:aClass];
+        _clauses = [NSMutableArray new];
+        _sortDescriptors = [NSMutableArray new];
+    }
+
+    return self;
+}
+
+#pragma mark - property
+
+- (NSPredicate *)predicate {
+    if (self.clauses.count == 0) {
+        return [NSPredicate predicateWithValue:YES];
+    }
+
+    return self.clauses.count == 1 ? self.clauses.firstObject :
+           [NSCompoundPredicate andPredicateWithSubpredicates:self.clauses];
+}
+
+- (ARMCollection *)collection {
+    ARMCollection *collection = [[[ARMQuery alloc] initWithClass:self.modelClass] whereWithPredicate:self.predicate];
+
+    return self.sortDescriptors.count > 0 ? [collection order:self.sortDescriptors] : collection;
+}
+
+- (NSArray<__kindof ARMActiveRealm *> *)toArray {
+    return [self.collection pageWithOffset:_offset limit:_limit > 0 ? _limit : NSUIntegerMax];
+}
+
+- (nullable __kindof ARMActiveRealm *)first {
+    return [self.collection pageWithOffset:_offset limit:1].firstObject;
+}
+
+- (NSUInteger)count {
+    // Counting does not need the sort.
+    NSUInteger count = [[[ARMQuery alloc] initWithClass:self.modelClass] whereWithPredicate:self.predicate].count;
+    count = count > _offset ? count - _offset : 0;
+
+    return _limit > 0 ? MIN(count, _limit) : count;
+}
+
+#pragma mark - public method
+
+- (instancetype)where:(NSDictionary<NSString *, id> *)dictionary {
+    for (NSString *prop in dictionary) {
+        [self addClause:[self predicateWithProperty:prop type:NSEqualToPredicateOperatorType value:dictionary[prop]]];
+    }
+
+    return self;
+}
+
+- (instancetype)whereNot:(NSDictionary<NSString *, id> *)dictionary {
+    if (dictionary.count == 0) {
+        return self;
+    }
+
+    // Excludes only the models matching all the pairs, as NOT (a == 1 AND b == 2).
+    NSMutableArray<NSPredicate *> *predicates = [NSMutableArray arrayWithCapacity:dictionary.count];
+    for (NSString *prop in dictionary) {
+        NSPredicate *predicate = [self predicateWithProperty:prop
+                                                        type:NSEqualToPredicateOperatorType
+                                                       value:dictionary[prop]];
+        [predicates addObject:predicate];
+    }
+    NSPredicate *matching = predicates.count == 1
+        ? predicates.firstObject
+        : [NSCompoundPredicate andPredicateWithSubpredicates:predicates];
+    [self addClause:[NSCompoundPredicate notPredicateWithSubpredicate:matching]];
+
+    return self;
+}
+
+- (instancetype)in:(NSString *)property values:(NSArray *)values {
+    [self addClause:[self predicateWithProperty:property type:NSInPredicateOperatorType value:values]];
+
+    return self;
+}
+
+- (instancetype)between:(NSString *)property lower:(id)lower upper:(id)upper {
+    // Same as BETWEEN, in the form every Realm version supports.
+    [self addClause:[self predicateWithProperty:property type:NSGreaterThanOrEqualToPredicateOperatorType value:lower]];
+    [self addClause:[self predicateWithProperty:property type:NSLessThanOrEqualToPredicateOperatorType value:upper]];
+
+    return self;
+}
+
+- (instancetype)like:(NSString *)property pattern:(NSString *)pattern {
+    [self addClause:[self predicateWithProperty:property type:NSLikePredicateOperatorType value:pattern]];
+
+    return self;
+}
+
+- (instancetype)orWhere:(ARMQueryBuilder *)builder {
+    if (builder.modelClass != self.modelClass) {
+        [NSException raise:NSInvalidArgumentException
+                    format:@"The builder of %@ can not be combined with %@.",
+                           NSStringFromClass(builder.modelClass), NSStringFromClass(self.modelClass)];
+    }
+
+    // A builder without clauses matches every model, so it would make the whole OR match every model.
+    if (builder.clauses.count == 0) {
+        return self;
+    }
+
+    if (self.clauses.count == 0) {
+        [self.clauses setArray:@[ builder.predicate ]];
+        return self;
+    }
+
+    NSPredicate *predicate = [NSCompoundPredicate orPredicateWithSubpredicates:@[ self.predicate, builder.predicate ]];
+    [self.clauses setArray:@[ predicate ]];
+
+    return self;
+}
+
+- (instancetype)order:(NSString *)property ascending:(BOOL)ascending {
+    [self validateProperty:property];
+    [self.sortDescriptors addObject:[RLMSortDescriptor sortDescriptorWithKeyPath:property ascending:ascending]];
+
+    return self;
+}
+
+- (instancetype)limit:(NSUInteger)limit {
+    _limit = limit;
+
+    return self;
+}
+
+- (instancetype)offset:(NSUInteger)offset {
+    _offset = offset;
+
+    return self;
+}
+
+- (NSString *)description {
+    return @{
+        @"modelClass": NSStringFromClass(self.modelClass),
+        @"predicate": self.predicate,
+        @"sortDescriptors": self.sortDescriptors,
+        @"limit": @(_limit),
+        @"offset": @(_offset)
+    }.description;
+}
+
+#pragma mark - private method
+
+- (void)addClause:(NSPredicate *)predicate {
+    [self.clauses addObject:predicate];
+}
+
+- (NSPredicate *)predicateWithProperty:(NSString *)property
+                                  type:(NSPredicateOperatorType)type
+                                 value:(nullable id)value {
+
+    [self validateProperty:property];
+
+    NSExpression *left = [NSExpression expressionForKeyPath:property];
+    NSExpression *right = [NSExpression expressionForConstantValue:value != [NSNull null] ? value : nil];
+
+    return [NSComparisonPredicate predicateWithLeftExpression:left
+                                              rightExpression:right
+                                                     modifier:NSDirectPredicateModifier
+                                                         type:type
+                                                      options:0];
+}
+
+- (void)validateProperty:(NSString *)property {
+    if (![self.schema.propertyNames containsObject:property]) {
+        [NSException raise:NSInvalidArgumentException
+                    format:@"%@ does not have the property '%@'.", NSStringFromClass(self.modelClass), property];
+    }
+}
+
+@end
@@ -29,11 +29,24 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class ARMActiveRealm;
+@class ARMModelSchema;
 @class ARMRelationship;
 
 @interface ARMRelation (Internal)
 
-+ (instancetype)relationWithObject:(ARMActiveRealm *)activeRealm relationship:(ARMRelationship *)relationship;
++ (instancetype)relationWithObject:(ARMActiveRealm *)activeRealm
+                      relationship:(ARMRelationship *)relationship
+                    foreignKeyName:(NSString *)foreignKeyName;
+
+@end
+
+/**
+ * The `relations` of a model. It creates a relation each time a key is accessed and none for the other keys. It holds
+ * the model, but the model does not hold it, so a new dictionary is made for each access of `relations`.
+ */
+@interface ARMRelationDictionary : NSDictionary<NSString *, ARMRelation *>
+
+- (instancetype)initWithObject:(ARMActiveRealm *)activeRealm schema:(ARMModelSchema *)schema;
 
 @end
 
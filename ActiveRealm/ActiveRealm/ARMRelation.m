@@ -29,7 +29,7 @@
 
 #import "ARMActiveRealm.h"
 #import "ARMActiveRealm+Internal.h"
-#import "ARMActiveRealmManager.h"
+#import "ARMModelSchema.h"
 #import "ARMRelationship.h"
 
 @interface ARMRelation ()
@@ -99,21 +99,60 @@
 
 @implementation ARMRelation (Internal)
 
-+ (instancetype)relationWithObject:(ARMActiveRealm *)activeRealm relationship:(ARMRelationship *)relationship {
++ (instancetype)relationWithObject:(ARMActiveRealm *)activeRealm
+                      relationship:(ARMRelationship *)relationship
+                    foreignKeyName:(NSString *)foreignKeyName {
+
     ARMRelation *relation = [ARMRelation new];
     relation.activeRealm = activeRealm;
     relation.relationship = relationship;
+    relation.foreignKeyName = foreignKeyName;
 
-    ARMActiveRealmManager *manager = [ARMActiveRealmManager sharedInstance];
+    return relation;
+}
 
-    NSString *className = relation.belongsTo ?
-        [manager stringFromClass:relationship.relationClass namespace:nil] :
-        [manager stringFromClass:activeRealm.class namespace:nil];
-    relation.foreignKeyName = [NSString stringWithFormat:@"%@%@ID",
-                                                         [className substringToIndex:1].lowercaseString,
-                                                         [className substringFromIndex:1]];
+@end
 
-    return relation;
+@implementation ARMRelationDictionary {
+    // The model does not hold this dictionary, so holding the model here makes no cycle.
+    ARMActiveRealm *_activeRealm;
+    ARMModelSchema *_schema;
+}
+
+- (instancetype)initWithObject:(ARMActiveRealm *)activeRealm schema:(ARMModelSchema *)schema {
+    self = [super init];
+
+    if (self) {
+        _activeRealm = activeRealm;
+        _schema = schema;
+    }
+
+    return self;
+}
+
+- (NSUInteger)count {
+    return _schema.relationships.count;
+}
+
+- (nullable ARMRelation *)objectForKey:(NSString *)key {
+    ARMRelationship *relationship = _schema.relationships[key];
+
+    if (!relationship) {
+        return nil;
+    }
+
+    return [ARMRelation relationWithObject:_activeRealm
+                              relationship:relationship
+                            foreignKeyName:_schema.foreignKeyNames[key]];
+}
+
+- (NSEnumerator<NSString *> *)keyEnumerator {
+    return _schema.relationships.keyEnumerator;
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+    // Immutable, and copying must not create all relations.
+    return self;
 }
 
 @end
@@ -39,7 +39,12 @@ FOUNDATION_EXPORT const unsigned char ActiveRealmVersionString[];
 #import "ARMActiveRealm.h"
 #import "ARMActiveRealmManager.h"
 #import "ARMCollection.h"
+#import "ARMColumn.h"
+#import "ARMCursor.h"
+#import "ARMGroup.h"
 #import "ARMObject.h"
+#import "ARMPreparedQuery.h"
 #import "ARMQuery.h"
+#import "ARMQueryBuilder.h"
 #import "ARMRelation.h"
 #import "ARMRelationship.h"
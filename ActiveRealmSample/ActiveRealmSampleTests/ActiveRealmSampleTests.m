@@ -8,6 +8,60 @@
 
 #import <XCTest/XCTest.h>
 
+#import <ActiveRealm/ActiveRealm.h>
+#import <Realm/RLMRealm_Dynamic.h>
+
+#import "Article.h"
+#import "Author.h"
+
+static const NSUInteger kBenchmarkRowCount = 100000;
+// The table size of the point lookup benchmarks.
+static const NSUInteger kLookupBenchmarkRowCount = 1000000;
+
+// Internal methods of the framework that the hydration benchmarks compare.
+@interface ARMActiveRealm (Hydrating)
+
++ (instancetype)activeRealmWithRLMObject:(RLMObject *)obj;
+- (void)setObject:(id)obj forKeyedSubscript:(NSString *)prop;
+
+@end
+
+// A model whose initializer creates another model before the model itself is initialized.
+@interface ActiveRealmNestingAuthor : ARMObject
+
+@property NSString *name;
+@property NSNumber <RLMInt> *age;
+
+@end
+
+@implementation ActiveRealmNestingAuthor
+
+@end
+
+@interface NestingAuthor : Author
+
+@property (nonatomic) Author *companion;
+
+@end
+
+@implementation NestingAuthor
+
++ (NSArray<NSString *> *)ignoredProperties {
+    return [[super ignoredProperties] arrayByAddingObject:@"companion"];
+}
+
+- (instancetype)init {
+    Author *companion = [Author new];
+
+    if (self = [super init]) {
+        _companion = companion;
+    }
+
+    return self;
+}
+
+@end
+
 @interface ActiveRealmSampleTests : XCTestCase
 
 @end
@@ -16,6 +70,11 @@
 
 - (void)setUp {
     // Put setup code here. This method is called before the invocation of each test method in the class.
+
+    // Each test uses its own in-memory Realm.
+    RLMRealmConfiguration *configuration = [RLMRealmConfiguration defaultConfiguration];
+    configuration.inMemoryIdentifier = self.name;
+    [RLMRealmConfiguration setDefaultConfiguration:configuration];
 }
 
 - (void)tearDown {
@@ -34,4 +93,1057 @@
     }];
 }
 
+#pragma mark - test
+
+- (void)testPagingWithCursorWhileWriting {
+    NSMutableSet<NSString *> *remainingIDs = [NSMutableSet new];
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        Author *author = [Author new];
+        // Ties on the name are broken by createdAt and uid. Mixed case checks the order of strings.
+        author.name = [NSString stringWithFormat:i % 2 ? @"Author%02lu" : @"author%02lu", (unsigned long) (i % 30)];
+        author.age = @(i);
+        XCTAssertTrue([author save]);
+        [remainingIDs addObject:author.uid];
+    }
+
+    ARMCollection *collection = [Author.query.all order:@"name" ascending:YES];
+    NSMutableArray<Author *> *seen = [NSMutableArray new];
+    NSArray<Author *> *page = [collection pageAfter:nil limit:7];
+
+    while (page.count > 0) {
+        [seen addObjectsFromArray:page];
+
+        // Write before and after the cursor between pages.
+        Author *inserted = [Author new];
+        inserted.name = seen.count % 2 ? @"A" : @"z";
+        inserted.age = @0;
+        XCTAssertTrue([inserted save]);
+
+        Author *deleted = [collection lastWithLimit:1].firstObject;
+        [remainingIDs removeObject:deleted.uid];
+        [deleted destroy];
+
+        page = [collection pageAfter:[collection cursorForObject:seen.lastObject] limit:7];
+    }
+
+    NSArray<NSString *> *seenIDs = [seen valueForKey:@"uid"];
+    XCTAssertEqual([NSSet setWithArray:seenIDs].count, seenIDs.count, @"A model appeared on two pages.");
+
+    for (NSString *uid in remainingIDs) {
+        XCTAssertTrue([seenIDs containsObject:uid], @"A model present throughout paging was skipped.");
+    }
+
+    for (NSUInteger i = 1; i < seen.count; i++) {
+        XCTAssertLessThanOrEqual(strcmp(seen[i - 1].name.UTF8String, seen[i].name.UTF8String), 0);
+    }
+}
+
+- (void)testPagingWithCursorOverMixedCaseAndNonASCIIKeys {
+    NSArray<NSString *> *names = @[
+        @"a", @"A", @"z", @"Z", @"\u00E9", @"e\u0301", @"É", @"e", @"ß", @"ss", @"Ä", @"あ", @"😀", @"", @"a "
+    ];
+
+    for (NSString *name in names) {
+        // Two models per name, so the cursor also has to break ties by createdAt and uid.
+        for (NSUInteger i = 0; i < 2; i++) {
+            [Author insertAll:@[ @{ @"name": name, @"age": @(i) } ]];
+        }
+    }
+
+    for (NSNumber *ascending in @[ @YES, @NO ]) {
+        ARMCollection *collection = [Author.query.all order:@"name" ascending:ascending.boolValue];
+        NSArray<Author *> *authors = collection.toArray;
+
+        // The cursor of each model finds the next model in the order Realm sorted them.
+        for (NSUInteger i = 0; i < authors.count; i++) {
+            NSArray<Author *> *page = [collection pageAfter:[collection cursorForObject:authors[i]] limit:1];
+            XCTAssertEqualObjects(page.firstObject.uid, i + 1 < authors.count ? authors[i + 1].uid : nil,
+                                  @"After %@ (%lu)", authors[i].name, (unsigned long) i);
+        }
+    }
+}
+
+- (void)testBelongsToRelationWithoutForeignKey {
+    Article *article = [Article new];
+
+    XCTAssertNil(article.relations[@"author"].object);
+}
+
+- (void)testEnumeratingInBatches {
+    [self seedAuthorsWithCount:10];
+    ARMCollection *collection = Author.query.all;
+    NSMutableArray<NSNumber *> *sizes = [NSMutableArray new];
+
+    [collection enumerateInBatchesOfSize:4 usingBlock:^(NSArray<Author *> *batch, BOOL *stop) {
+        [sizes addObject:@(batch.count)];
+    }];
+
+    XCTAssertEqualObjects(sizes, (@[ @4, @4, @2 ]));
+    XCTAssertThrowsSpecificNamed([collection enumerateInBatchesOfSize:0 usingBlock:^(NSArray *batch, BOOL *stop) {
+    }], NSException, NSInvalidArgumentException);
+}
+
+- (void)testInsertingAllRows {
+    NSDate *createdAt = [NSDate dateWithTimeIntervalSince1970:1000];
+
+    for (NSNumber *options in @[ @(ARMInsertingOptionNone), @(ARMInsertingOptionWithCallbacks) ]) {
+        [Author destroyAll];
+        NSArray<NSDictionary *> *rows = @[
+            @{ @"uid": @"GIVEN-UID", @"name": @"Alice", @"age": @20, @"createdAt": createdAt },
+            @{ @"uid": [NSNull null], @"name": @"Bob", @"age": @30, @"createdAt": [NSNull null] },
+            @{ @"name": @"Carol", @"age": @40 }
+        ];
+
+        NSArray<NSString *> *uids = [Author insertAll:rows options:options.integerValue chunkSize:2];
+
+        XCTAssertEqual(uids.count, 3);
+        XCTAssertEqual([NSSet setWithArray:uids].count, 3);
+        XCTAssertEqualObjects(uids.firstObject, @"GIVEN-UID");
+        XCTAssertEqual(Author.query.all.count, 3);
+
+        Author *alice = [Author findByID:@"GIVEN-UID"];
+        XCTAssertEqualObjects(alice.createdAt, createdAt);
+        XCTAssertEqualObjects(alice.updatedAt, createdAt);
+
+        for (NSString *uid in [uids subarrayWithRange:NSMakeRange(1, 2)]) {
+            Author *author = [Author findByID:uid];
+            XCTAssertGreaterThan(uid.length, 0);
+            XCTAssertNotNil(author.createdAt);
+            XCTAssertEqualObjects(author.updatedAt, author.createdAt);
+        }
+
+        // An existing or repeated key is rejected before anything is written, not overwritten.
+        XCTAssertThrowsSpecificNamed([Author insertAll:@[ @{ @"name": @"Dave" },
+                                                          @{ @"uid": @"GIVEN-UID", @"name": @"Eve" } ]
+                                               options:options.integerValue
+                                             chunkSize:1], NSException, NSInvalidArgumentException);
+        XCTAssertThrowsSpecificNamed([Author insertAll:@[ @{ @"uid": @"NEW", @"name": @"Dave" },
+                                                          @{ @"uid": @"NEW", @"name": @"Eve" } ]
+                                               options:options.integerValue
+                                             chunkSize:1], NSException, NSInvalidArgumentException);
+        XCTAssertEqual(Author.query.all.count, 3);
+        XCTAssertEqualObjects([Author findByID:@"GIVEN-UID"].name, @"Alice");
+    }
+}
+
+- (void)testInsertingAllRowsValidatedOnlyWithCallbacks {
+    // Author requires a name.
+    NSArray<NSDictionary *> *rows = @[ @{ @"name": @"Alice", @"age": @20 }, @{ @"name": @"", @"age": @30 } ];
+
+    XCTAssertEqual([Author insertAll:rows options:ARMInsertingOptionWithCallbacks chunkSize:0].count, 1);
+    XCTAssertEqual(Author.query.all.count, 1);
+
+    [Author destroyAll];
+
+    XCTAssertEqual([Author insertAll:rows].count, 2);
+    XCTAssertEqual(Author.query.all.count, 2);
+}
+
+- (void)testInsertingAllRowsWithOneTimestamp {
+    NSMutableArray<NSDictionary *> *rows = [NSMutableArray new];
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        [rows addObject:@{ @"name": [NSString stringWithFormat:@"Author%lu", (unsigned long) i], @"age": @20 }];
+    }
+
+    for (NSNumber *options in @[ @(ARMInsertingOptionNone), @(ARMInsertingOptionWithCallbacks) ]) {
+        [Author destroyAll];
+        NSArray<NSString *> *uids = [Author insertAll:rows options:options.integerValue chunkSize:7];
+
+        // No row is stamped after the call, so a query up to now finds all of them.
+        NSArray<NSDate *> *dates = [Author.query.all pluck:@[ @"createdAt" ]];
+        XCTAssertEqual([NSSet setWithArray:dates].count, 1);
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"createdAt <= %@", [NSDate date]];
+        XCTAssertEqual([Author.query whereWithPredicate:predicate].count, rows.count);
+
+        // The primary keys break the ties.
+        XCTAssertEqualObjects([Author.query.all pluck:@[ @"uid" ]],
+                              [uids sortedArrayUsingSelector:@selector(compare:)]);
+    }
+}
+
+- (void)testSavingOnlyChangedProperties {
+    Author *author = [Author new];
+    author.name = @"Alice";
+    author.age = @20;
+    XCTAssertTrue([author save]);
+
+    NSDate *updatedAt = author.updatedAt;
+    RLMObject *obj = [[RLMRealm defaultRealm] objectWithClassName:@"ActiveRealmAuthor" forPrimaryKey:author.uid];
+    NSMutableArray<NSArray<NSString *> *> *writes = [NSMutableArray new];
+    __block XCTestExpectation *expectation = nil;
+    RLMNotificationToken *token = [obj addNotificationBlock:^(BOOL deleted,
+                                                             NSArray<RLMPropertyChange *> *changes,
+                                                             NSError *error) {
+        [writes addObject:[changes valueForKey:@"name"]];
+        [expectation fulfill];
+    }];
+
+    // An unchanged model is not written and keeps its timestamp.
+    expectation = [self expectationWithDescription:@"No write"];
+    expectation.inverted = YES;
+    XCTAssertTrue([author save]);
+    [self waitForExpectations:@[ expectation ] timeout:0.5];
+
+    XCTAssertEqual(writes.count, 0);
+    XCTAssertEqualObjects(author.updatedAt, updatedAt);
+    XCTAssertEqualObjects([Author findByID:author.uid].updatedAt, updatedAt);
+
+    // Only the changed property and the timestamp are written.
+    expectation = [self expectationWithDescription:@"Write"];
+    author.age = @21;
+    XCTAssertTrue([author save]);
+    [self waitForExpectations:@[ expectation ] timeout:1];
+
+    XCTAssertEqualObjects([NSSet setWithArray:writes.lastObject], ([NSSet setWithArray:@[ @"age", @"updatedAt" ]]));
+    XCTAssertNotEqualObjects(author.updatedAt, updatedAt);
+    XCTAssertEqualObjects([Author findByID:author.uid].age, @21);
+
+    [token invalidate];
+}
+
+- (void)testSavingAllAcrossChunks {
+    NSMutableArray<Author *> *authors = [NSMutableArray new];
+    NSMutableArray<Author *> *invalidAuthors = [NSMutableArray new];
+
+    // 23 models are saved in chunks of 5, so the last chunk is partial.
+    for (NSUInteger i = 0; i < 23; i++) {
+        Author *author = [Author new];
+        // Author requires a name, so every fourth model fails the validation.
+        author.name = i % 4 == 0 ? @"" : [NSString stringWithFormat:@"Author%lu", (unsigned long) i];
+        author.age = @(i);
+        [authors addObject:author];
+
+        if (i % 4 == 0) {
+            [invalidAuthors addObject:author];
+        }
+    }
+
+    NSArray<Author *> *failed = [Author saveAll:authors options:ARMSavingOptionNone chunkSize:5];
+
+    XCTAssertEqualObjects(failed, invalidAuthors);
+    XCTAssertEqual(Author.query.all.count, authors.count - invalidAuthors.count);
+
+    for (Author *author in authors) {
+        BOOL valid = ![invalidAuthors containsObject:author];
+        XCTAssertEqual([Author existsWithID:author.uid], valid);
+    }
+}
+
+- (void)testBuildingQuery {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30, @"Carol": @40, @"Dave": @30, @"Eve": @50 }];
+
+    ARMQueryBuilder *builder = [Author.query.builder where:@{ @"name": @"Alice" }];
+    [builder orWhere:[Author.query.builder where:@{ @"age": @30 }]];
+    [[builder order:@"age" ascending:NO] order:@"name" ascending:YES];
+
+    NSPredicate *expected = [NSPredicate predicateWithFormat:@"name == %@ OR age == %@", @"Alice", @30];
+    XCTAssertEqualObjects(builder.predicate, expected);
+    // The first order is the primary key of the sort and the next one breaks ties.
+    XCTAssertEqualObjects([builder.collection.toArray valueForKey:@"name"], (@[ @"Bob", @"Dave", @"Alice" ]));
+
+    [builder limit:2];
+    XCTAssertEqualObjects([builder.toArray valueForKey:@"name"], (@[ @"Bob", @"Dave" ]));
+    XCTAssertEqual(builder.count, 2);
+
+    [builder offset:2];
+    XCTAssertEqualObjects([builder.toArray valueForKey:@"name"], (@[ @"Alice" ]));
+    XCTAssertEqual(builder.count, 1);
+    Author *first = builder.first;
+    XCTAssertEqualObjects(first.name, @"Alice");
+
+    ARMQueryBuilder *between = [Author.query.builder between:@"age" lower:@30 upper:@40];
+    XCTAssertEqualObjects(between.predicate, ([NSPredicate predicateWithFormat:@"age >= %@ AND age <= %@", @30, @40]));
+    XCTAssertEqual(between.count, 3);
+
+    XCTAssertThrowsSpecificNamed([Author.query.builder where:@{ @"unknown": @1 }],
+                                 NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([Author.query.builder order:@"unknown" ascending:YES],
+                                 NSException, NSInvalidArgumentException);
+}
+
+- (void)testBuildingOrQueryWithoutClauses {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30, @"Carol": @40 }];
+
+    // An empty builder matches every model, so it is left out of OR.
+    ARMQueryBuilder *builder = [Author.query.builder orWhere:[Author.query.builder where:@{ @"age": @30 }]];
+    XCTAssertEqualObjects(builder.predicate, ([NSPredicate predicateWithFormat:@"age == %@", @30]));
+    XCTAssertEqualObjects([builder.toArray valueForKey:@"name"], @[ @"Bob" ]);
+
+    [builder orWhere:Author.query.builder];
+    XCTAssertEqualObjects([builder.toArray valueForKey:@"name"], @[ @"Bob" ]);
+}
+
+- (void)testBuildingWhereNotQueryWithSeveralKeys {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30, @"Carol": @30 }];
+
+    ARMQueryBuilder *one = [Author.query.builder whereNot:@{ @"age": @30 }];
+    XCTAssertEqualObjects(one.predicate, ([NSPredicate predicateWithFormat:@"NOT (age == %@)", @30]));
+    XCTAssertEqualObjects([one.toArray valueForKey:@"name"], @[ @"Alice" ]);
+
+    // Only the model matching both pairs is excluded, not every model matching either of them.
+    ARMQueryBuilder *both = [Author.query.builder whereNot:@{ @"name": @"Bob", @"age": @30 }];
+    [both order:@"name" ascending:YES];
+    XCTAssertEqualObjects([both.toArray valueForKey:@"name"], (@[ @"Alice", @"Carol" ]));
+}
+
+- (void)testGroupingAndDistinct {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30, @"Carol": @40, @"Dave": @30, @"Eve": @20 }];
+
+    NSArray<ARMGroup *> *groups = [Author.query.all groupBy:@"age" aggregating:@"age"];
+
+    XCTAssertEqualObjects([groups valueForKey:@"key"], (@[ @20, @30, @40 ]));
+    XCTAssertEqualObjects([groups valueForKey:@"count"], (@[ @2, @2, @1 ]));
+    XCTAssertEqualObjects(groups[1].sum, @60);
+    XCTAssertEqualObjects(groups[1].average, @30);
+    XCTAssertEqualObjects(groups[1].min, @30);
+    XCTAssertEqualObjects(groups[1].max, @30);
+    XCTAssertNil([Author.query.all groupBy:@"age"].firstObject.sum);
+    XCTAssertEqualObjects(groups[1].sum, [[Author.query where:@{ @"age": @30 }] sum:@"age"]);
+
+    // The model kept for each age is the first one in the current order.
+    ARMCollection *ascending = [[Author.query.all order:@"name" ascending:YES] distinct:@[ @"age" ]];
+    XCTAssertEqualObjects([ascending.toArray valueForKey:@"name"], (@[ @"Alice", @"Bob", @"Carol" ]));
+
+    ARMCollection *descending = [[Author.query.all order:@"name" ascending:NO] distinct:@[ @"age" ]];
+    XCTAssertEqualObjects([descending.toArray valueForKey:@"name"], (@[ @"Eve", @"Dave", @"Carol" ]));
+    XCTAssertEqual(descending.count, 3);
+}
+
+- (void)testGroupingIntegerSumWithoutPrecisionLoss {
+    // 2^53 + 1 is not representable as a double.
+    for (NSNumber *age in @[ @(1LL << 53), @1 ]) {
+        Author *author = [Author new];
+        author.name = @"Alice";
+        author.age = age;
+        XCTAssertTrue([author save]);
+    }
+
+    ARMGroup *group = [Author.query.all groupBy:@"name" aggregating:@"age"].firstObject;
+
+    XCTAssertEqual(group.sum.longLongValue, (1LL << 53) + 1);
+    XCTAssertEqualObjects(group.sum, [Author sum:@"age"]);
+}
+
+- (void)testReleasingModelAfterAccessingRelations {
+    __weak Author *weakAuthor = nil;
+
+    @autoreleasepool {
+        Author *author = [Author new];
+        author.name = @"Alice";
+        author.age = @20;
+        XCTAssertTrue([author save]);
+
+        XCTAssertEqualObjects(author.relations[@"articles"].objects, @[]);
+        XCTAssertEqual(author.relations.allValues.count, author.relations.count);
+        weakAuthor = author;
+    }
+
+    // The model does not hold its relations, so it is released with them.
+    XCTAssertNil(weakAuthor);
+}
+
+- (void)testRelationOutlivingModelVariable {
+    ARMRelation *relation = nil;
+
+    @autoreleasepool {
+        Author *author = [Author new];
+        author.name = @"Alice";
+        author.age = @20;
+        XCTAssertTrue([author save]);
+
+        Article *article = [Article new];
+        article.authorID = author.uid;
+        article.title = @"Title";
+        article.text = @"Text";
+        XCTAssertTrue([article save]);
+
+        relation = author.relations[@"articles"];
+    }
+
+    // The relation holds the model, so it still returns related objects.
+    XCTAssertEqual(relation.objects.count, 1);
+}
+
+- (void)testPreparedQueryOrdersTiesAsCollection {
+    NSMutableArray<NSDictionary *> *rows = [NSMutableArray new];
+
+    // Inserted in the reverse order of creation, so the ties on the age are not in the order of the table.
+    for (NSUInteger i = 0; i < 20; i++) {
+        [rows addObject:@{
+            @"name": [NSString stringWithFormat:@"Author%lu", (unsigned long) i],
+            @"age": @(i % 2),
+            @"createdAt": [NSDate dateWithTimeIntervalSince1970:1000 - i]
+        }];
+    }
+
+    [Author insertAll:rows options:ARMInsertingOptionNone chunkSize:0];
+
+    NSPredicate *template = [NSPredicate predicateWithFormat:@"age >= $age"];
+    RLMSortDescriptor *byAge = [RLMSortDescriptor sortDescriptorWithKeyPath:@"age" ascending:YES];
+    ARMPreparedQuery *query = [[ARMPreparedQuery alloc] initWithClass:Author.class
+                                                    predicateTemplate:template
+                                                      sortDescriptors:@[ byAge ]
+                                                                limit:0];
+    ARMCollection *collection = [[Author.query whereWithFormat:@"age >= %@", @0] order:@"age" ascending:YES];
+
+    XCTAssertEqualObjects([[query executeWithBindings:@{ @"age": @0 }] valueForKey:@"uid"],
+                          [collection.toArray valueForKey:@"uid"]);
+}
+
+- (void)testRoundTrippingPersistedModel {
+    Author *author = [Author new];
+    author.name = @"Alice";
+    author.age = @20;
+    XCTAssertTrue([author save]);
+
+    XCTAssertFalse([Author.propertyNames containsObject:@"persisted"]);
+
+    Author *found = [Author findByID:author.uid];
+    XCTAssertEqualObjects(found.name, @"Alice");
+
+    found.age = @21;
+    XCTAssertTrue([found save]);
+    XCTAssertEqualObjects([Author findByID:author.uid].age, @21);
+    XCTAssertEqual(Author.query.all.count, 1);
+
+    NSDictionary *dictionary = [found asDictionary];
+    XCTAssertEqualObjects(dictionary[@"uid"], author.uid);
+    XCTAssertEqualObjects(dictionary[@"age"], @21);
+    XCTAssertNil(dictionary[@"persisted"]);
+}
+
+- (void)testRejectingInvalidColumnArguments {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30, @"Carol": @40 }];
+    ARMColumn *ages = [Author.query.all pluckDouble:@"age"];
+
+    XCTAssertEqualObjects([ages histogramWithBucketCount:2 minimum:20 maximum:40], (@[ @1, @2 ]));
+    NSMutableData *mask = [NSMutableData dataWithLength:ages.nullBitmap.length];
+    memset(mask.mutableBytes, 0xFF, mask.length);
+    XCTAssertEqual([ages sumWithMask:mask], 90);
+
+    XCTAssertThrowsSpecificNamed([ages histogramWithBucketCount:0 minimum:0 maximum:100],
+                                 NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([ages histogramWithBucketCount:10 minimum:100 maximum:100],
+                                 NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([ages histogramWithBucketCount:10 minimum:100 maximum:0],
+                                 NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([ages sumWithMask:[NSData data]], NSException, NSInvalidArgumentException);
+}
+
+- (void)testExistingWithID {
+    Author *author = [Author new];
+    author.name = @"Alice";
+    author.age = @20;
+    XCTAssertFalse([Author existsWithID:author.uid]);
+    XCTAssertTrue([author save]);
+
+    XCTAssertTrue([Author existsWithID:author.uid]);
+    XCTAssertFalse([Author existsWithID:@"UNKNOWN"]);
+    // The foreign key of an unsaved belongsTo relation may be nil.
+    XCTAssertFalse([Author existsWithID:nil]);
+    XCTAssertNil([Author findByID:nil]);
+}
+
+- (void)testTakingFirstAndLastWithLimit {
+    [self seedAuthorsWithCount:10];
+    ARMCollection *collection = Author.query.all;
+
+    XCTAssertEqualObjects([[collection firstWithLimit:3] valueForKey:@"name"],
+                          (@[ @"Author0", @"Author1", @"Author2" ]));
+    // The last models are in the order of the collection, not reversed.
+    XCTAssertEqualObjects([[collection lastWithLimit:3] valueForKey:@"name"],
+                          (@[ @"Author7", @"Author8", @"Author9" ]));
+    XCTAssertEqualObjects([[collection firstWithLimit:20] valueForKey:@"uid"], [collection.toArray valueForKey:@"uid"]);
+    XCTAssertEqualObjects([[collection lastWithLimit:20] valueForKey:@"uid"], [collection.toArray valueForKey:@"uid"]);
+    XCTAssertEqualObjects([collection firstWithLimit:0], @[]);
+    XCTAssertEqualObjects([collection lastWithLimit:0], @[]);
+    XCTAssertEqualObjects([[Author lastWithLimit:2] valueForKey:@"name"], (@[ @"Author8", @"Author9" ]));
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    XCTAssertEqualObjects([[Author firstOrderedBy:@"age" ascending:NO limit:2] valueForKey:@"name"],
+                          (@[ @"Author9", @"Author8" ]));
+    XCTAssertEqualObjects([[Author lastOrderedBy:@"age" ascending:NO limit:2] valueForKey:@"name"],
+                          (@[ @"Author1", @"Author0" ]));
+    XCTAssertEqualObjects([[Author whereWithPredicate:[NSPredicate predicateWithFormat:@"age >= 5"]
+                                            orderedBy:@"age"
+                                            ascending:YES
+                                                limit:2] valueForKey:@"name"], (@[ @"Author5", @"Author6" ]));
+    XCTAssertEqualObjects([[Author whereOrderedBy:@"age" ascending:NO limit:3 format:@"age < 5"]
+                           valueForKey:@"name"], (@[ @"Author4", @"Author3", @"Author2" ]));
+    XCTAssertEqualObjects([[Author where:@{ @"age": @5 } orderedBy:@"age" ascending:YES limit:0] valueForKey:@"name"],
+                          @[]);
+#pragma clang diagnostic pop
+}
+
+- (void)testAccessingLazyArray {
+    // More than three windows of 32 models.
+    [self seedAuthorsWithCount:100];
+    ARMCollection *collection = Author.query.all;
+    NSArray<NSString *> *uids = [collection.toArray valueForKey:@"uid"];
+    NSArray<Author *> *authors = collection.toLazyArray;
+
+    XCTAssertEqual(authors.count, uids.count);
+
+    // Forward and backward across the window boundaries, and within the last partial window.
+    for (NSNumber *idx in @[ @0, @31, @32, @63, @64, @99, @96, @95, @5, @33 ]) {
+        XCTAssertEqualObjects(authors[idx.unsignedIntegerValue].uid, uids[idx.unsignedIntegerValue]);
+    }
+
+    XCTAssertThrowsSpecificNamed(authors[100], NSException, NSRangeException);
+
+    // A model held by the caller stays the same instance after the window moves away and back.
+    Author *held = authors[1];
+    held.name = @"Changed";
+    XCTAssertNotNil(authors[90]);
+    XCTAssertEqual(authors[1], held);
+    XCTAssertEqual([authors indexOfObjectIdenticalTo:held], 1);
+    XCTAssertEqualObjects(authors[1].name, @"Changed");
+
+    NSMutableArray<NSString *> *enumeratedUIDs = [NSMutableArray new];
+
+    for (Author *author in authors) {
+        [enumeratedUIDs addObject:author.uid];
+    }
+
+    XCTAssertEqualObjects(enumeratedUIDs, uids);
+
+    // The array is a snapshot, so a later write does not change it.
+    Author *author = [Author new];
+    author.name = @"Alice";
+    author.age = @20;
+    XCTAssertTrue([author save]);
+    [[Author findByID:uids.firstObject] destroy];
+
+    XCTAssertEqual(authors.count, uids.count);
+    XCTAssertEqualObjects(authors.firstObject.uid, uids.firstObject);
+    XCTAssertEqualObjects(authors.lastObject.uid, uids.lastObject);
+}
+
+- (void)testAccessingLazyArrayInWriteTransaction {
+    [self seedAuthorsWithCount:40];
+    NSArray<NSString *> *uids = [Author.query.all.toArray valueForKey:@"uid"];
+    RLMRealm *realm = [RLMRealm defaultRealm];
+
+    // A Realm can not be frozen in a write transaction, so the array reads the live results.
+    [realm beginWriteTransaction];
+    NSArray<Author *> *authors = Author.query.all.toLazyArray;
+
+    XCTAssertEqual(authors.count, uids.count);
+    XCTAssertEqualObjects([[authors subarrayWithRange:NSMakeRange(30, 10)] valueForKey:@"uid"],
+                          [uids subarrayWithRange:NSMakeRange(30, 10)]);
+
+    [realm cancelWriteTransaction];
+}
+
+- (void)testChainingOrdersWithTieBreakers {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1000];
+    NSDate *laterDate = [date dateByAddingTimeInterval:1];
+
+    // Inserted in no particular order. Ties on age and name fall back to createdAt, then to uid.
+    [Author insertAll:@[
+        @{ @"uid": @"C", @"name": @"Alice", @"age": @20, @"createdAt": laterDate },
+        @{ @"uid": @"B", @"name": @"Bob", @"age": @20, @"createdAt": date },
+        @{ @"uid": @"A", @"name": @"Alice", @"age": @30, @"createdAt": laterDate },
+        @{ @"uid": @"A2", @"name": @"Alice", @"age": @20, @"createdAt": laterDate },
+        @{ @"uid": @"Z", @"name": @"Alice", @"age": @20, @"createdAt": date }
+    ]];
+    NSArray<NSString *> *expected = @[ @"A", @"Z", @"A2", @"C", @"B" ];
+
+    // The later order takes precedence and the earlier one breaks its ties.
+    ARMCollection *chained = [[Author.query.all order:@"name" ascending:YES] order:@"age" ascending:NO];
+    XCTAssertEqualObjects([chained.toArray valueForKey:@"uid"], expected);
+    XCTAssertEqualObjects([chained.toLazyArray valueForKey:@"uid"], expected);
+
+    // In one call, the first sort descriptor takes precedence.
+    ARMCollection *combined = [Author.query.all order:@[
+        [RLMSortDescriptor sortDescriptorWithKeyPath:@"age" ascending:NO],
+        [RLMSortDescriptor sortDescriptorWithKeyPath:@"name" ascending:YES]
+    ]];
+    XCTAssertEqualObjects([combined.toArray valueForKey:@"uid"], expected);
+
+    // Without orders, createdAt and uid decide the order.
+    XCTAssertEqualObjects([Author.query.all.toArray valueForKey:@"uid"], (@[ @"B", @"Z", @"A", @"A2", @"C" ]));
+}
+
+- (void)testFindingByIDs {
+    [self seedAuthorsWithCount:50];
+    NSArray<NSString *> *uids = [Author.query.all pluck:@[ @"uid" ]];
+
+    // Up to 32 IDs are probed one by one. More IDs are found with a single query.
+    for (NSNumber *count in @[ @4, @40 ]) {
+        // Reversed, with an unknown ID and a repeated ID.
+        NSMutableArray<NSString *> *ids = [NSMutableArray new];
+
+        for (NSUInteger i = 0; i < count.unsignedIntegerValue - 2; i++) {
+            [ids insertObject:uids[i] atIndex:0];
+        }
+
+        [ids insertObject:@"UNKNOWN" atIndex:1];
+        [ids addObject:ids.firstObject];
+
+        NSMutableArray<NSString *> *expected = ids.mutableCopy;
+        [expected removeObject:@"UNKNOWN"];
+
+        NSArray<Author *> *authors = [Author findByIDs:ids];
+        XCTAssertEqualObjects([authors valueForKey:@"uid"], expected);
+        XCTAssertEqual(authors.firstObject, authors.lastObject, @"A repeated ID must be built once.");
+
+        NSDictionary<NSString *, Author *> *dictionary = [Author findDictionaryByIDs:ids];
+        XCTAssertEqualObjects([NSSet setWithArray:dictionary.allKeys], [NSSet setWithArray:expected]);
+        XCTAssertNil(dictionary[@"UNKNOWN"]);
+    }
+
+    XCTAssertEqualObjects([Author findByIDs:@[]], @[]);
+}
+
+- (void)testQueryingWithDictionaryAsFormat {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1000];
+    NSDate *laterDate = [date dateByAddingTimeInterval:1];
+    [Author insertAll:@[
+        @{ @"name": @"Alice", @"age": @20, @"createdAt": date },
+        @{ @"name": @"Alice", @"age": @30, @"createdAt": laterDate },
+        @{ @"name": @"Bob", @"age": @20, @"createdAt": date },
+        @{ @"name": @"Carol", @"age": [NSNull null], @"createdAt": laterDate }
+    ]];
+
+    // Built in different key orders, so they share a cached template.
+    NSMutableDictionary *nameAndAge = [NSMutableDictionary new];
+    nameAndAge[@"name"] = @"Alice";
+    nameAndAge[@"age"] = @20;
+    NSMutableDictionary *ageAndName = [NSMutableDictionary new];
+    ageAndName[@"age"] = @30;
+    ageAndName[@"name"] = @"Alice";
+
+    NSDictionary<NSDictionary *, NSNumber *> *counts = @{
+        nameAndAge: @1,
+        ageAndName: @1,
+        @{ @"name": @"Alice", @"age": @40 }: @0,
+        @{ @"age": [NSNull null] }: @1,
+        @{ @"createdAt": date }: @2,
+        @{ @"createdAt": date, @"name": @"Bob" }: @1
+    };
+
+    for (NSDictionary *dictionary in counts) {
+        NSArray *uids = [[Author.query where:dictionary].toArray valueForKey:@"uid"];
+        NSPredicate *predicate = [self predicateWithFormatFromDictionary:dictionary];
+
+        XCTAssertEqual(uids.count, counts[dictionary].unsignedIntegerValue, @"%@", dictionary);
+        XCTAssertEqualObjects(uids, [[Author.query whereWithPredicate:predicate].toArray valueForKey:@"uid"]);
+    }
+}
+
+- (void)testQueryingWithEmptyDictionary {
+    [self saveAuthorsWithNamesAndAges:@{ @"Alice": @20, @"Bob": @30 }];
+
+    // An empty dictionary must not match every model.
+    XCTAssertThrowsSpecificNamed([Author destroy:@{}], NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([Author exists:@{}], NSException, NSInvalidArgumentException);
+    XCTAssertThrowsSpecificNamed([Author.query where:@{}], NSException, NSInvalidArgumentException);
+    XCTAssertEqual(Author.query.all.count, 2);
+}
+
+- (void)testHydratingModelWhoseInitializerCreatesModel {
+    NestingAuthor *author = [NestingAuthor new];
+    author.name = @"Alice";
+    author.age = @20;
+    XCTAssertTrue([author save]);
+
+    NestingAuthor *found = [NestingAuthor findByID:author.uid];
+
+    XCTAssertEqualObjects(found.uid, author.uid);
+    XCTAssertEqualObjects(found.createdAt, author.createdAt);
+    // The model created by the initializer is initialized normally.
+    XCTAssertGreaterThan(found.companion.uid.length, 0);
+    XCTAssertNotEqualObjects(found.companion.uid, found.uid);
+    XCTAssertNotNil(found.companion.createdAt);
+}
+
+#pragma mark - benchmark
+
+// No results are recorded for these benchmarks, so they do not show that any path is faster.
+// Run each pair on the same device and compare the two before relying on the difference.
+
+- (void)testPerformanceHydratingAllAuthors {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSArray<Author *> *authors = Author.query.all.toArray;
+            XCTAssertEqual(authors.count, kBenchmarkRowCount);
+        }
+    }];
+}
+
+/**
+ * Hydrates as collections did before `activeRealmWithRLMObject:`. Paired with
+ * `testPerformanceHydratingAuthorsFromStoredObjects` over the same stored objects.
+ */
+- (void)testPerformanceHydratingAuthorsWithSetters {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    RLMResults *results = [[RLMRealm defaultRealm] allObjects:@"ActiveRealmAuthor"];
+    NSArray<NSString *> *propertyNames = Author.propertyNames;
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSMutableArray<Author *> *authors = [NSMutableArray arrayWithCapacity:results.count];
+
+            for (RLMObject *obj in results) {
+                Author *author = [Author new];
+
+                for (NSString *prop in propertyNames) {
+                    author[prop] = obj[prop];
+                }
+
+                [authors addObject:author];
+            }
+
+            XCTAssertEqual(authors.count, kBenchmarkRowCount);
+        }
+    }];
+}
+
+- (void)testPerformanceHydratingAuthorsFromStoredObjects {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    RLMResults *results = [[RLMRealm defaultRealm] allObjects:@"ActiveRealmAuthor"];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSMutableArray<Author *> *authors = [NSMutableArray arrayWithCapacity:results.count];
+
+            for (RLMObject *obj in results) {
+                [authors addObject:[Author activeRealmWithRLMObject:obj]];
+            }
+
+            XCTAssertEqual(authors.count, kBenchmarkRowCount);
+        }
+    }];
+}
+
+- (void)testPerformanceAccessingVisibleAuthorsLazily {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSArray<Author *> *authors = Author.query.all.toLazyArray;
+            XCTAssertEqual(authors.count, kBenchmarkRowCount);
+
+            // Like a table view showing about 30 rows.
+            for (NSUInteger i = 0; i < 30; i++) {
+                XCTAssertNotNil(authors[kBenchmarkRowCount / 2 + i].name);
+            }
+        }
+    }];
+}
+
+- (void)testPerformancePagingAuthorsWithCursor {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            ARMCollection *collection = Author.query.all;
+            ARMCursor *cursor = [collection cursorForObject:collection[kBenchmarkRowCount - 100]];
+            NSArray<Author *> *authors = [collection pageAfter:cursor limit:50];
+            XCTAssertEqual(authors.count, 50);
+        }
+    }];
+}
+
+- (void)testPerformanceEnumeratingAuthorsInBatches {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        __block NSUInteger count = 0;
+
+        [Author.query.all enumerateInBatchesOfSize:1000 usingBlock:^(NSArray<Author *> *batch, BOOL *stop) {
+            count += batch.count;
+        }];
+
+        XCTAssertEqual(count, kBenchmarkRowCount);
+    }];
+}
+
+- (void)testPerformanceSummingAgesNatively {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        XCTAssertGreaterThan([Author sum:@"age"].integerValue, 0);
+    }];
+}
+
+- (void)testPerformanceSummingPluckedAges {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            NSInteger sum = 0;
+
+            for (NSNumber *age in [Author.query.all pluck:@[ @"age" ]]) {
+                sum += age.integerValue;
+            }
+
+            XCTAssertGreaterThan(sum, 0);
+        }
+    }];
+}
+
+- (void)testPerformancePluckingAgesIntoColumn {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+
+    [self measureBlock:^{
+        ARMColumn *ages = [Author.query.all pluckDouble:@"age"];
+        XCTAssertEqual(ages.count, kBenchmarkRowCount);
+    }];
+}
+
+- (void)testPerformanceColumnStatistics {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    ARMColumn *ages = [Author.query.all pluckDouble:@"age"];
+
+    [self measureBlock:^{
+        XCTAssertEqualWithAccuracy(ages.mean, 49.5, 0.001);
+        XCTAssertGreaterThan(ages.variance, 0);
+        XCTAssertEqual(ages.minimum, 0);
+        XCTAssertEqual(ages.maximum, 99);
+    }];
+}
+
+/**
+ * Computes the same statistics with plain loops. Paired with `testPerformanceColumnStatistics`.
+ */
+- (void)testPerformanceColumnStatisticsWithLoops {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    ARMColumn *ages = [Author.query.all pluckDouble:@"age"];
+
+    [self measureBlock:^{
+        const double *values = ages.doubleValues;
+        double sum = 0;
+        double minimum = INFINITY;
+        double maximum = -INFINITY;
+
+        for (NSUInteger i = 0; i < ages.count; i++) {
+            sum += values[i];
+            minimum = MIN(minimum, values[i]);
+            maximum = MAX(maximum, values[i]);
+        }
+
+        double mean = sum / ages.count;
+        double squares = 0;
+
+        for (NSUInteger i = 0; i < ages.count; i++) {
+            squares += (values[i] - mean) * (values[i] - mean);
+        }
+
+        XCTAssertEqualWithAccuracy(mean, 49.5, 0.001);
+        XCTAssertGreaterThan(squares / ages.count, 0);
+        XCTAssertEqual(minimum, 0);
+        XCTAssertEqual(maximum, 99);
+    }];
+}
+
+- (void)testPerformanceColumnHistogram {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    ARMColumn *ages = [Author.query.all pluckInt64:@"age"];
+
+    [self measureBlock:^{
+        NSArray<NSNumber *> *histogram = [ages histogramWithBucketCount:10 minimum:0 maximum:100];
+        XCTAssertEqual([[histogram valueForKeyPath:@"@sum.self"] unsignedIntegerValue], kBenchmarkRowCount);
+    }];
+}
+
+- (void)testPerformanceFindingAuthorsByID {
+    [self seedAuthorsWithCount:kLookupBenchmarkRowCount];
+    NSArray<NSString *> *uids = [[Author.query.all pluck:@[ @"uid" ]] subarrayWithRange:NSMakeRange(0, 1000)];
+
+    [self measureBlock:^{
+        for (NSString *uid in uids) {
+            XCTAssertNotNil([Author findByID:uid]);
+        }
+    }];
+}
+
+- (void)testPerformanceFindingAuthorsByIDPredicate {
+    [self seedAuthorsWithCount:kLookupBenchmarkRowCount];
+    NSArray<NSString *> *uids = [[Author.query.all pluck:@[ @"uid" ]] subarrayWithRange:NSMakeRange(0, 1000)];
+
+    [self measureBlock:^{
+        for (NSString *uid in uids) {
+            XCTAssertNotNil([Author findWithPredicate:[NSPredicate predicateWithFormat:@"uid=%@", uid]]);
+        }
+    }];
+}
+
+- (void)testPerformanceFindingAuthorsByIDs {
+    [self seedAuthorsWithCount:kBenchmarkRowCount];
+    NSArray<NSString *> *uids = [[Author.query.all pluck:@[ @"uid" ]] subarrayWithRange:NSMakeRange(0, 1000)];
+
+    [self measureBlock:^{
+        XCTAssertEqual([Author findByIDs:uids].count, uids.count);
+    }];
+}
+
+- (void)testPerformanceBuildingDictionaryQueries {
+    [self seedAuthorsWithCount:1000];
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 10000; i++) {
+            @autoreleasepool {
+                [Author.query where:@{ @"name": @"Alice", @"age": @(i % 100) }];
+            }
+        }
+    }];
+}
+
+/**
+ * Builds the same queries by parsing a format string, as `where:` did before. Paired with
+ * `testPerformanceBuildingDictionaryQueries`.
+ */
+- (void)testPerformanceBuildingDictionaryQueriesWithFormat {
+    [self seedAuthorsWithCount:1000];
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 10000; i++) {
+            @autoreleasepool {
+                NSPredicate *predicate = [self predicateWithFormatFromDictionary:@{ @"name": @"Alice",
+                                                                                   @"age": @(i % 100) }];
+                [Author.query whereWithPredicate:predicate];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceExecutingPreparedQuery {
+    [self seedAuthorsWithCount:1000];
+    NSPredicate *template = [NSPredicate predicateWithFormat:@"age == $age"];
+    ARMPreparedQuery *query = [[ARMPreparedQuery alloc] initWithClass:Author.class
+                                                    predicateTemplate:template
+                                                      sortDescriptors:nil
+                                                                limit:5];
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000; i++) {
+            @autoreleasepool {
+                XCTAssertEqual([query executeWithBindings:@{ @"age": @(i % 100) }].count, 5);
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceLookingUpArticlesByIndexedForeignKey {
+    NSArray<NSString *> *authorIDs = [self seedArticlesWithCount:kBenchmarkRowCount authorCount:1000];
+
+    // authorID is indexed because Article belongs to Author.
+    [self measureBlock:^{
+        for (NSString *authorID in [authorIDs subarrayWithRange:NSMakeRange(0, 100)]) {
+            XCTAssertEqual([Article.query where:@{ @"authorID": authorID }].count, 100);
+        }
+    }];
+}
+
+- (void)testPerformanceLookingUpArticlesByUnindexedProperty {
+    NSArray<NSString *> *authorIDs = [self seedArticlesWithCount:kBenchmarkRowCount authorCount:1000];
+
+    // title holds the same values as authorID without the index.
+    [self measureBlock:^{
+        for (NSString *authorID in [authorIDs subarrayWithRange:NSMakeRange(0, 100)]) {
+            XCTAssertEqual([Article.query where:@{ @"title": authorID }].count, 100);
+        }
+    }];
+}
+
+- (void)testPerformanceAccessingHasManyRelation {
+    [self seedArticlesWithCount:kBenchmarkRowCount authorCount:1000];
+    NSArray<Author *> *authors = [Author.query.all firstWithLimit:100];
+
+    [self measureBlock:^{
+        @autoreleasepool {
+            for (Author *author in authors) {
+                XCTAssertEqual(author.relations[@"articles"].objects.count, 100);
+            }
+        }
+    }];
+}
+
+#pragma mark - private method
+
+/**
+ * Inserts authors through the dynamic Realm API so that seeding does not depend on the code being measured.
+ */
+- (void)seedAuthorsWithCount:(NSUInteger)count {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    NSDate *now = [NSDate date];
+
+    [realm transactionWithBlock:^{
+        for (NSUInteger i = 0; i < count; i++) {
+            [realm createObject:@"ActiveRealmAuthor" withValue:@{
+                @"uid": [NSUUID UUID].UUIDString,
+                @"createdAt": [now dateByAddingTimeInterval:i],
+                @"updatedAt": now,
+                @"name": [NSString stringWithFormat:@"Author%lu", (unsigned long) i],
+                @"age": @(i % 100)
+            }];
+        }
+    }];
+}
+
+/**
+ * Builds the predicate of a dictionary by a format string, as `where:` did before the templates were cached.
+ */
+- (NSPredicate *)predicateWithFormatFromDictionary:(NSDictionary<NSString *, id> *)dictionary {
+    NSMutableArray *formats = [NSMutableArray new];
+    NSMutableArray *arguments = [NSMutableArray new];
+
+    for (NSString *prop in dictionary.allKeys) {
+        [formats addObject:[prop stringByAppendingString:@"=%@"]];
+        [arguments addObject:dictionary[prop]];
+    }
+
+    return [NSPredicate predicateWithFormat:[formats componentsJoinedByString:@" AND "] argumentArray:arguments];
+}
+
+- (void)saveAuthorsWithNamesAndAges:(NSDictionary<NSString *, NSNumber *> *)namesAndAges {
+    for (NSString *name in namesAndAges) {
+        Author *author = [Author new];
+        author.name = name;
+        author.age = namesAndAges[name];
+        XCTAssertTrue([author save]);
+    }
+}
+
+- (NSArray<NSString *> *)seedArticlesWithCount:(NSUInteger)count authorCount:(NSUInteger)authorCount {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    NSDate *now = [NSDate date];
+    NSMutableArray<NSString *> *authorIDs = [NSMutableArray arrayWithCapacity:authorCount];
+
+    [realm transactionWithBlock:^{
+        for (NSUInteger i = 0; i < authorCount; i++) {
+            NSString *authorID = [NSUUID UUID].UUIDString;
+            [authorIDs addObject:authorID];
+            [realm createObject:@"ActiveRealmAuthor" withValue:@{
+                @"uid": authorID,
+                @"createdAt": [now dateByAddingTimeInterval:i],
+                @"updatedAt": now,
+                @"name": [NSString stringWithFormat:@"Author%lu", (unsigned long) i],
+                @"age": @(i % 100)
+            }];
+        }
+
+        for (NSUInteger i = 0; i < count; i++) {
+            NSString *authorID = authorIDs[i % authorCount];
+            [realm createObject:@"ActiveRealmArticle" withValue:@{
+                @"uid": [NSUUID UUID].UUIDString,
+                @"createdAt": [now dateByAddingTimeInterval:i],
+                @"updatedAt": now,
+                @"authorID": authorID,
+                @"title": authorID,
+                @"text": @"text"
+            }];
+        }
+    }];
+
+    return authorIDs;
+}
+
 @end